@@ -0,0 +1,138 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Times generating C++ for deeply nested expressions (run with
+ *    `make bench-codegen`)
+ *  - Token trees are built directly rather than parsed, so only codegen is
+ *    measured. Time per byte of output should stay flat as depth grows
+ *  - Expressions this deep are lowered to A-normal form (see CodeGen.hpp)
+ *  - Prints one JSON object per shape and depth
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+#include <Token.hpp>
+#include <CodeGen.hpp>
+
+using namespace nabd;
+
+Token leaf(const TokenType type, const std::string &value) {
+    return { type, value, 0, 0, { } };
+}
+
+/*
+ * Trees are built bottom up, so the nested child is moved in rather than
+ * copied (an initializer list would copy it, making building quadratic)
+ */
+Token node(
+        const TokenType type, std::vector<Token> before, Token nested,
+        std::vector<Token> after) {
+    Token tok = { type, "", 0, 0, std::move(before) };
+    tok.children.push_back(std::move(nested));
+    for(auto &child : after) {
+        tok.children.push_back(std::move(child));
+    }
+    return tok;
+}
+
+Token wrapExpr(Token inner) {
+    return node(TokenType::Expr, { }, std::move(inner), { });
+}
+
+Token callOf(Token param) {
+    return wrapExpr(node(
+        TokenType::FuncCall, {
+            leaf(TokenType::Identifier, "inc"), leaf(TokenType::LPar, "(")
+        }, std::move(param), { leaf(TokenType::RPar, ")") }
+    ));
+}
+
+Token tupleOf(Token snd) {
+    return wrapExpr(node(
+        TokenType::TupDef, {
+            leaf(TokenType::LCurl, "{"), leaf(TokenType::Identifier, "x"),
+            leaf(TokenType::Comma, ",")
+        }, std::move(snd), { leaf(TokenType::RCurl, "}") }
+    ));
+}
+
+Token ternaryOf(Token falseExpr) {
+    return wrapExpr(node(
+        TokenType::Ternary, {
+            leaf(TokenType::Exclam, "!"), leaf(TokenType::Identifier, "x"),
+            leaf(TokenType::QMark, "?"),
+            wrapExpr(leaf(TokenType::Decimal, "1")),
+            leaf(TokenType::Colon, ":")
+        }, std::move(falseExpr), { }
+    ));
+}
+
+Token listOf(Token last) {
+    return wrapExpr(node(
+        TokenType::ListDef, {
+            leaf(TokenType::LBrak, "["), leaf(TokenType::Identifier, "x"),
+            leaf(TokenType::Comma, ",")
+        }, std::move(last), { leaf(TokenType::RBrak, "]") }
+    ));
+}
+
+// f = x > <expression nested depth times>.
+template<typename Wrap>
+Token deepFuncDef(const size_t depth, Wrap wrap) {
+    Token expr = leaf(TokenType::Identifier, "x");
+    for(size_t i = 0; i < depth; i++) {
+        expr = wrap(std::move(expr));
+    }
+    return node(
+        TokenType::FuncDef, {
+            leaf(TokenType::Identifier, "f"), leaf(TokenType::EquSign, "="),
+            leaf(TokenType::Identifier, "x"), leaf(TokenType::RArr, ">")
+        }, std::move(expr), { leaf(TokenType::Period, ".") }
+    );
+}
+
+template<typename Wrap>
+void benchShape(
+        const std::string &shape, const nabd::InputArguments &cliInputs,
+        Wrap wrap) {
+    const int repeats = 5;
+    // Already deeper than the parser manages, which hits the stack limit
+    for(size_t depth = 1000; depth <= 8000; depth *= 2) {
+        const auto funcDef = deepFuncDef(depth, wrap);
+
+        double bestMs = -1;
+        size_t bytes = 0;
+        for(int i = 0; i < repeats; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            std::string code;
+            codegen::generateFuncDefCode(
+                funcDef, cliInputs, types::TypeContext(), code
+            );
+            const std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - start;
+            bestMs = bestMs < 0 ? elapsed.count() : std::min(
+                bestMs, elapsed.count()
+            );
+            bytes = code.length();
+        }
+
+        std::cout
+            << "{\"shape\": \"" << shape << "\", \"depth\": " << depth
+            << ", \"bytes\": " << bytes << ", \"ms\": " << bestMs
+            << ", \"ns_per_byte\": " << bestMs * 1e6 / bytes << "}"
+            << std::endl;
+    }
+}
+
+int main(void) {
+    // Deep expressions always get lowered to A-normal form
+    nabd::InputArguments cliInputs;
+    benchShape("call", cliInputs, callOf);
+    benchShape("tuple", cliInputs, tupleOf);
+    benchShape("ternary", cliInputs, ternaryOf);
+    benchShape("list", cliInputs, listOf);
+}
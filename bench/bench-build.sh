@@ -0,0 +1,169 @@
+#!/bin/bash
+#
+# Author: Dylan Turner
+# Description:
+#  - End-to-end build latency benchmarks for nabc (run with `make bench-build`)
+#  - Times cold builds, no-op rebuilds, one-file-edit rebuilds and link-only
+#    runs of the examples and of generated multi-module projects
+#  - Writes one JSON object per line to the results file with the wall time
+#    and nabc's own parse/codegen/g++/link breakdown (see --timings)
+#
+# Usage: bench-build.sh <nabc> <work folder> [results file]
+# Settings (environment):
+#  - BENCH_JOBS: make -j for every build (default: number of cpus)
+#  - BENCH_MODULES, BENCH_DEFS: size of the "synth-wide" project
+#  - BENCH_BIG_DEFS: definitions in the single module of "synth-big"
+
+set -e
+
+NABC=$(realpath "$1")
+WORK=$2
+RESULTS=${3:-$WORK/results.jsonl}
+JOBS=${BENCH_JOBS:-$(nproc)}
+MODULES=${BENCH_MODULES:-16}
+DEFS=${BENCH_DEFS:-100}
+BIG_DEFS=${BENCH_BIG_DEFS:-1000}
+
+REPO=$(realpath "$(dirname "$0")/..")
+STD_INC=$REPO/lib/include
+
+if [ ! -x "$NABC" ] || [ "$WORK" == "" ]; then
+    echo "Usage: $0 <nabc> <work folder> [results file]"
+    exit 1
+fi
+
+mkdir -p "$WORK"
+WORK=$(realpath "$WORK")
+RESULTS=$(realpath -m "$RESULTS")
+: > "$RESULTS"
+
+now_ms() {
+    echo $(($(date +%s%N) / 1000000))
+}
+
+# Same layout as the examples: one .o per module, then nabc links the program
+write_makefile() {
+    cat > "$1/Makefile" << MAKEFILE
+NABC :=			$NABC
+INC :=			-I $STD_INC
+OBJNAME :=		$2
+SRC :=			\$(wildcard *.nabd)
+OBJS :=			\$(subst .nabd,.o,\$(SRC))
+
+%.o : %.nabd
+	\$(NABC) \$< \$(INC)
+
+\$(OBJNAME) : \$(OBJS)
+	\$(NABC) \$@ -k \$(OBJS)
+MAKEFILE
+}
+
+# A chain of modules where each calls into the one before it
+generate_project() {
+    local folder=$1 modules=$2 defs=$3
+    rm -rf "$folder"
+    mkdir -p "$folder"
+    for ((m = 0; m < modules; m++)); do
+        {
+            echo "\$std\$"
+            if ((m > 0)); then
+                echo "\$mod$((m - 1))\$"
+            fi
+            echo
+            for ((d = 0; d < defs; d++)); do
+                if ((d > 0)); then
+                    echo "m${m}f${d} = x >"
+                    echo "    ! gt({ x, 0d${d}# }) ?"
+                    echo "        m${m}f$((d - 1))(dec(x)) :"
+                    echo "        [ print('m${m}f${d}\\n'), inc(x) ]."
+                elif ((m > 0)); then
+                    echo "m${m}f0 = x > m$((m - 1))f$((defs - 1))(x)."
+                else
+                    echo "m0f0 = x > print(x)."
+                fi
+            done
+        } > "$folder/mod$m.nabd"
+    done
+    {
+        echo "\$std\$"
+        echo "\$mod$((modules - 1))\$"
+        echo
+        echo "main = args > m$((modules - 1))f$((defs - 1))(0d3#)."
+    } > "$folder/main.nabd"
+    write_makefile "$folder" "Synth"
+}
+
+# Timed make of a corpus, then the phase breakdown from nabc's timings
+run_scenario() {
+    local corpus=$1 scenario=$2 folder=$3
+    local timings=$WORK/$corpus-$scenario.timings
+    : > "$timings"
+
+    local start end
+    start=$(now_ms)
+    NABC_TIMINGS=$timings make -s -j"$JOBS" -C "$folder" > /dev/null
+    end=$(now_ms)
+
+    awk -v corpus="$corpus" -v scenario="$scenario" -v wall=$((end - start)) '
+        function field(name,    rest) {
+            rest = substr($0, index($0, "\"" name "\": ") + length(name) + 4)
+            return rest + 0
+        }
+        {
+            runs++
+            parse += field("parse_ms")
+            codegen += field("codegen_ms")
+            cxx += field("cxx_ms")
+            link += field("link_ms")
+        }
+        END {
+            printf("{\"corpus\": \"%s\", \"scenario\": \"%s\", ", \
+                corpus, scenario)
+            printf("\"wall_ms\": %d, \"nabc_runs\": %d, ", wall, runs)
+            printf("\"parse_ms\": %.3f, \"codegen_ms\": %.3f, ", \
+                parse, codegen)
+            printf("\"cxx_ms\": %.3f, \"link_ms\": %.3f}\n", cxx, link)
+        }' "$timings" | tee -a "$RESULTS"
+}
+
+clean_corpus() {
+    rm -rf "$1"/*_nabdout "$1"/*.o "$1/$2"
+}
+
+# The edit has to change the generated code, or nothing gets rebuilt
+bench_corpus() {
+    local corpus=$1 folder=$2 program=$3 edited=$4 edit=$5
+
+    clean_corpus "$folder" "$program"
+    run_scenario "$corpus" cold "$folder"
+    run_scenario "$corpus" noop "$folder"
+
+    sed -i "$edit" "$folder/$edited"
+    run_scenario "$corpus" edit "$folder"
+
+    rm -f "$folder/$program"
+    run_scenario "$corpus" link "$folder"
+}
+
+# Copies of the examples so the real ones (and their Makefiles) aren't touched
+for example in "truth-machine:TruthMachine:infLoop.nabd:s/0d1#/0d2#/" \
+        "guess-num:GuessTheNumber:main.nabd:s/You won!/You won!!/"; do
+    IFS=: read -r name program edited edit <<< "$example"
+    rm -rf "$WORK/$name"
+    mkdir -p "$WORK/$name"
+    cp "$REPO/examples/$name"/*.nabd "$WORK/$name"
+    write_makefile "$WORK/$name" "$program"
+    bench_corpus "$name" "$WORK/$name" "$program" "$edited" "$edit"
+done
+
+# Changes a single function (the first one that prints)
+SYNTH_EDIT="0,/print('m/s//print('edited m/"
+
+generate_project "$WORK/synth-wide" "$MODULES" "$DEFS"
+bench_corpus synth-wide "$WORK/synth-wide" Synth "mod$((MODULES / 2)).nabd" \
+    "$SYNTH_EDIT"
+
+generate_project "$WORK/synth-big" 1 "$BIG_DEFS"
+bench_corpus synth-big "$WORK/synth-big" Synth mod0.nabd "$SYNTH_EDIT"
+
+echo "Results written to $RESULTS"
@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Author: Dylan Turner
+# Description:
+#  - Compares two results files written by bench-build.sh, e.g. from the
+#    nabc on master and the nabc on a branch
+#
+# Usage: compare-build.sh <old results> <new results>
+
+set -e
+
+if [ ! -f "$1" ] || [ ! -f "$2" ]; then
+    echo "Usage: $0 <old results> <new results>"
+    exit 1
+fi
+
+awk '
+    function field(line, name,    rest) {
+        rest = substr(line, index(line, "\"" name "\": ") + length(name) + 4)
+        if(substr(rest, 1, 1) == "\"") {
+            return substr(rest, 2, index(substr(rest, 2), "\"") - 1)
+        }
+        return rest + 0
+    }
+    function change(before, after) {
+        if(before <= 0) {
+            return "-"
+        }
+        return sprintf("%+.1f%%", 100 * (after - before) / before)
+    }
+    {
+        key = field($0, "corpus") " " field($0, "scenario")
+        if(FNR == NR) {
+            oldWall[key] = field($0, "wall_ms")
+            oldCxx[key] = field($0, "cxx_ms")
+        } else {
+            order[++count] = key
+            newWall[key] = field($0, "wall_ms")
+            newCxx[key] = field($0, "cxx_ms")
+        }
+    }
+    END {
+        printf("%-28s %10s %10s %9s %10s %10s %9s\n", "benchmark", \
+            "old ms", "new ms", "change", "old g++", "new g++", "change")
+        for(i = 1; i <= count; i++) {
+            key = order[i]
+            if(!(key in oldWall)) {
+                continue
+            }
+            printf("%-28s %10d %10d %9s %10.0f %10.0f %9s\n", key, \
+                oldWall[key], newWall[key], \
+                change(oldWall[key], newWall[key]), \
+                oldCxx[key], newCxx[key], change(oldCxx[key], newCxx[key]))
+        }
+    }' "$1" "$2"
@@ -0,0 +1,36 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer startGame(const VariablePointer &randNum);
+VariablePointer guessFor(const VariablePointer &numAndAttempts);
+VariablePointer checkGuess(const VariablePointer &inputAndTupNumAtt);
+VariablePointer fake_main(const VariablePointer &args);
+VariablePointer startGame(const VariablePointer &randNum) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("Guess a number btwn 0 and 10: "))), std::dynamic_pointer_cast<Variable>(guessFor(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(randNum), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))), std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("The answer was "))), std::dynamic_pointer_cast<Variable>(print(randNum)), std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("\nEnter \'1\' to play again or \'0\' to quit: "))), std::dynamic_pointer_cast<Variable>(std::dynamic_pointer_cast<NumberVariable>(parseNum(input(std::make_shared<NumberVariable>(0)))->toNumber())->value > 0 ? startGame(round(random(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(0)), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10))))))) : std::make_shared<NumberVariable>(0)),  }));
+}
+VariablePointer guessFor(const VariablePointer &numAndAttempts) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("Guess (integer): "))), std::dynamic_pointer_cast<Variable>(checkGuess(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(parseNum(input(std::make_shared<NumberVariable>(0)))), std::dynamic_pointer_cast<Variable>(numAndAttempts))))),  }));
+}
+VariablePointer checkGuess(const VariablePointer &inputAndTupNumAtt) {
+    return std::dynamic_pointer_cast<NumberVariable>(eq(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(fst(inputAndTupNumAtt)), std::dynamic_pointer_cast<Variable>(fst(snd(inputAndTupNumAtt))))))->toNumber())->value > 0 ? print(std::make_shared<StringVariable>("You won!\n")) : std::dynamic_pointer_cast<NumberVariable>(snd(snd(inputAndTupNumAtt))->toNumber())->value > 0 ? std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(fst(inputAndTupNumAtt)), std::dynamic_pointer_cast<Variable>(fst(snd(inputAndTupNumAtt))))))->toNumber())->value > 0 ? std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("Too high!\n"))), std::dynamic_pointer_cast<Variable>(guessFor(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(fst(snd(inputAndTupNumAtt))), std::dynamic_pointer_cast<Variable>(dec(snd(snd(inputAndTupNumAtt)))))))),  })) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("Too low!\n"))), std::dynamic_pointer_cast<Variable>(guessFor(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(fst(snd(inputAndTupNumAtt))), std::dynamic_pointer_cast<Variable>(dec(snd(snd(inputAndTupNumAtt)))))))),  })) : print(std::make_shared<StringVariable>("You lose!\n"));
+}
+VariablePointer fake_main(const VariablePointer &args) {
+    return snd(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(seedRandom(std::make_shared<NumberVariable>(static_cast<double>(0x0)))), std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("Welcome to Guess the Number!\n"))), std::dynamic_pointer_cast<Variable>(startGame(round(random(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(0)), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))))),  }))), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(0)))));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
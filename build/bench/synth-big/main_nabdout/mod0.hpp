@@ -0,0 +1,103 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer m0f0(const VariablePointer &x);
+VariablePointer m0f1(const VariablePointer &x);
+VariablePointer m0f2(const VariablePointer &x);
+VariablePointer m0f3(const VariablePointer &x);
+VariablePointer m0f4(const VariablePointer &x);
+VariablePointer m0f5(const VariablePointer &x);
+VariablePointer m0f6(const VariablePointer &x);
+VariablePointer m0f7(const VariablePointer &x);
+VariablePointer m0f8(const VariablePointer &x);
+VariablePointer m0f9(const VariablePointer &x);
+VariablePointer m0f10(const VariablePointer &x);
+VariablePointer m0f11(const VariablePointer &x);
+VariablePointer m0f12(const VariablePointer &x);
+VariablePointer m0f13(const VariablePointer &x);
+VariablePointer m0f14(const VariablePointer &x);
+VariablePointer m0f15(const VariablePointer &x);
+VariablePointer m0f16(const VariablePointer &x);
+VariablePointer m0f17(const VariablePointer &x);
+VariablePointer m0f18(const VariablePointer &x);
+VariablePointer m0f19(const VariablePointer &x);
+VariablePointer m0f20(const VariablePointer &x);
+VariablePointer m0f21(const VariablePointer &x);
+VariablePointer m0f22(const VariablePointer &x);
+VariablePointer m0f23(const VariablePointer &x);
+VariablePointer m0f24(const VariablePointer &x);
+VariablePointer m0f25(const VariablePointer &x);
+VariablePointer m0f26(const VariablePointer &x);
+VariablePointer m0f27(const VariablePointer &x);
+VariablePointer m0f28(const VariablePointer &x);
+VariablePointer m0f29(const VariablePointer &x);
+VariablePointer m0f30(const VariablePointer &x);
+VariablePointer m0f31(const VariablePointer &x);
+VariablePointer m0f32(const VariablePointer &x);
+VariablePointer m0f33(const VariablePointer &x);
+VariablePointer m0f34(const VariablePointer &x);
+VariablePointer m0f35(const VariablePointer &x);
+VariablePointer m0f36(const VariablePointer &x);
+VariablePointer m0f37(const VariablePointer &x);
+VariablePointer m0f38(const VariablePointer &x);
+VariablePointer m0f39(const VariablePointer &x);
+VariablePointer m0f40(const VariablePointer &x);
+VariablePointer m0f41(const VariablePointer &x);
+VariablePointer m0f42(const VariablePointer &x);
+VariablePointer m0f43(const VariablePointer &x);
+VariablePointer m0f44(const VariablePointer &x);
+VariablePointer m0f45(const VariablePointer &x);
+VariablePointer m0f46(const VariablePointer &x);
+VariablePointer m0f47(const VariablePointer &x);
+VariablePointer m0f48(const VariablePointer &x);
+VariablePointer m0f49(const VariablePointer &x);
+VariablePointer m0f50(const VariablePointer &x);
+VariablePointer m0f51(const VariablePointer &x);
+VariablePointer m0f52(const VariablePointer &x);
+VariablePointer m0f53(const VariablePointer &x);
+VariablePointer m0f54(const VariablePointer &x);
+VariablePointer m0f55(const VariablePointer &x);
+VariablePointer m0f56(const VariablePointer &x);
+VariablePointer m0f57(const VariablePointer &x);
+VariablePointer m0f58(const VariablePointer &x);
+VariablePointer m0f59(const VariablePointer &x);
+VariablePointer m0f60(const VariablePointer &x);
+VariablePointer m0f61(const VariablePointer &x);
+VariablePointer m0f62(const VariablePointer &x);
+VariablePointer m0f63(const VariablePointer &x);
+VariablePointer m0f64(const VariablePointer &x);
+VariablePointer m0f65(const VariablePointer &x);
+VariablePointer m0f66(const VariablePointer &x);
+VariablePointer m0f67(const VariablePointer &x);
+VariablePointer m0f68(const VariablePointer &x);
+VariablePointer m0f69(const VariablePointer &x);
+VariablePointer m0f70(const VariablePointer &x);
+VariablePointer m0f71(const VariablePointer &x);
+VariablePointer m0f72(const VariablePointer &x);
+VariablePointer m0f73(const VariablePointer &x);
+VariablePointer m0f74(const VariablePointer &x);
+VariablePointer m0f75(const VariablePointer &x);
+VariablePointer m0f76(const VariablePointer &x);
+VariablePointer m0f77(const VariablePointer &x);
+VariablePointer m0f78(const VariablePointer &x);
+VariablePointer m0f79(const VariablePointer &x);
+VariablePointer m0f80(const VariablePointer &x);
+VariablePointer m0f81(const VariablePointer &x);
+VariablePointer m0f82(const VariablePointer &x);
+VariablePointer m0f83(const VariablePointer &x);
+VariablePointer m0f84(const VariablePointer &x);
+VariablePointer m0f85(const VariablePointer &x);
+VariablePointer m0f86(const VariablePointer &x);
+VariablePointer m0f87(const VariablePointer &x);
+VariablePointer m0f88(const VariablePointer &x);
+VariablePointer m0f89(const VariablePointer &x);
+VariablePointer m0f90(const VariablePointer &x);
+VariablePointer m0f91(const VariablePointer &x);
+VariablePointer m0f92(const VariablePointer &x);
+VariablePointer m0f93(const VariablePointer &x);
+VariablePointer m0f94(const VariablePointer &x);
+VariablePointer m0f95(const VariablePointer &x);
+VariablePointer m0f96(const VariablePointer &x);
+VariablePointer m0f97(const VariablePointer &x);
+VariablePointer m0f98(const VariablePointer &x);
+VariablePointer m0f99(const VariablePointer &x);
+
@@ -0,0 +1,402 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer m0f0(const VariablePointer &x);
+VariablePointer m0f1(const VariablePointer &x);
+VariablePointer m0f2(const VariablePointer &x);
+VariablePointer m0f3(const VariablePointer &x);
+VariablePointer m0f4(const VariablePointer &x);
+VariablePointer m0f5(const VariablePointer &x);
+VariablePointer m0f6(const VariablePointer &x);
+VariablePointer m0f7(const VariablePointer &x);
+VariablePointer m0f8(const VariablePointer &x);
+VariablePointer m0f9(const VariablePointer &x);
+VariablePointer m0f10(const VariablePointer &x);
+VariablePointer m0f11(const VariablePointer &x);
+VariablePointer m0f12(const VariablePointer &x);
+VariablePointer m0f13(const VariablePointer &x);
+VariablePointer m0f14(const VariablePointer &x);
+VariablePointer m0f15(const VariablePointer &x);
+VariablePointer m0f16(const VariablePointer &x);
+VariablePointer m0f17(const VariablePointer &x);
+VariablePointer m0f18(const VariablePointer &x);
+VariablePointer m0f19(const VariablePointer &x);
+VariablePointer m0f20(const VariablePointer &x);
+VariablePointer m0f21(const VariablePointer &x);
+VariablePointer m0f22(const VariablePointer &x);
+VariablePointer m0f23(const VariablePointer &x);
+VariablePointer m0f24(const VariablePointer &x);
+VariablePointer m0f25(const VariablePointer &x);
+VariablePointer m0f26(const VariablePointer &x);
+VariablePointer m0f27(const VariablePointer &x);
+VariablePointer m0f28(const VariablePointer &x);
+VariablePointer m0f29(const VariablePointer &x);
+VariablePointer m0f30(const VariablePointer &x);
+VariablePointer m0f31(const VariablePointer &x);
+VariablePointer m0f32(const VariablePointer &x);
+VariablePointer m0f33(const VariablePointer &x);
+VariablePointer m0f34(const VariablePointer &x);
+VariablePointer m0f35(const VariablePointer &x);
+VariablePointer m0f36(const VariablePointer &x);
+VariablePointer m0f37(const VariablePointer &x);
+VariablePointer m0f38(const VariablePointer &x);
+VariablePointer m0f39(const VariablePointer &x);
+VariablePointer m0f40(const VariablePointer &x);
+VariablePointer m0f41(const VariablePointer &x);
+VariablePointer m0f42(const VariablePointer &x);
+VariablePointer m0f43(const VariablePointer &x);
+VariablePointer m0f44(const VariablePointer &x);
+VariablePointer m0f45(const VariablePointer &x);
+VariablePointer m0f46(const VariablePointer &x);
+VariablePointer m0f47(const VariablePointer &x);
+VariablePointer m0f48(const VariablePointer &x);
+VariablePointer m0f49(const VariablePointer &x);
+VariablePointer m0f50(const VariablePointer &x);
+VariablePointer m0f51(const VariablePointer &x);
+VariablePointer m0f52(const VariablePointer &x);
+VariablePointer m0f53(const VariablePointer &x);
+VariablePointer m0f54(const VariablePointer &x);
+VariablePointer m0f55(const VariablePointer &x);
+VariablePointer m0f56(const VariablePointer &x);
+VariablePointer m0f57(const VariablePointer &x);
+VariablePointer m0f58(const VariablePointer &x);
+VariablePointer m0f59(const VariablePointer &x);
+VariablePointer m0f60(const VariablePointer &x);
+VariablePointer m0f61(const VariablePointer &x);
+VariablePointer m0f62(const VariablePointer &x);
+VariablePointer m0f63(const VariablePointer &x);
+VariablePointer m0f64(const VariablePointer &x);
+VariablePointer m0f65(const VariablePointer &x);
+VariablePointer m0f66(const VariablePointer &x);
+VariablePointer m0f67(const VariablePointer &x);
+VariablePointer m0f68(const VariablePointer &x);
+VariablePointer m0f69(const VariablePointer &x);
+VariablePointer m0f70(const VariablePointer &x);
+VariablePointer m0f71(const VariablePointer &x);
+VariablePointer m0f72(const VariablePointer &x);
+VariablePointer m0f73(const VariablePointer &x);
+VariablePointer m0f74(const VariablePointer &x);
+VariablePointer m0f75(const VariablePointer &x);
+VariablePointer m0f76(const VariablePointer &x);
+VariablePointer m0f77(const VariablePointer &x);
+VariablePointer m0f78(const VariablePointer &x);
+VariablePointer m0f79(const VariablePointer &x);
+VariablePointer m0f80(const VariablePointer &x);
+VariablePointer m0f81(const VariablePointer &x);
+VariablePointer m0f82(const VariablePointer &x);
+VariablePointer m0f83(const VariablePointer &x);
+VariablePointer m0f84(const VariablePointer &x);
+VariablePointer m0f85(const VariablePointer &x);
+VariablePointer m0f86(const VariablePointer &x);
+VariablePointer m0f87(const VariablePointer &x);
+VariablePointer m0f88(const VariablePointer &x);
+VariablePointer m0f89(const VariablePointer &x);
+VariablePointer m0f90(const VariablePointer &x);
+VariablePointer m0f91(const VariablePointer &x);
+VariablePointer m0f92(const VariablePointer &x);
+VariablePointer m0f93(const VariablePointer &x);
+VariablePointer m0f94(const VariablePointer &x);
+VariablePointer m0f95(const VariablePointer &x);
+VariablePointer m0f96(const VariablePointer &x);
+VariablePointer m0f97(const VariablePointer &x);
+VariablePointer m0f98(const VariablePointer &x);
+VariablePointer m0f99(const VariablePointer &x);
+VariablePointer m0f0(const VariablePointer &x) {
+    return print(x);
+}
+VariablePointer m0f1(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(1)))))->toNumber())->value > 0 ? m0f0(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f1\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f2(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))->toNumber())->value > 0 ? m0f1(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f2\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f3(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(3)))))->toNumber())->value > 0 ? m0f2(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f3\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f4(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(4)))))->toNumber())->value > 0 ? m0f3(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f4\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f5(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(5)))))->toNumber())->value > 0 ? m0f4(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f5\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f6(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(6)))))->toNumber())->value > 0 ? m0f5(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f6\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f7(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(7)))))->toNumber())->value > 0 ? m0f6(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f7\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f8(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(8)))))->toNumber())->value > 0 ? m0f7(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f8\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f9(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(9)))))->toNumber())->value > 0 ? m0f8(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f9\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f10(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))->toNumber())->value > 0 ? m0f9(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f10\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f11(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(11)))))->toNumber())->value > 0 ? m0f10(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f11\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f12(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(12)))))->toNumber())->value > 0 ? m0f11(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f12\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f13(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(13)))))->toNumber())->value > 0 ? m0f12(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f13\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f14(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(14)))))->toNumber())->value > 0 ? m0f13(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f14\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f15(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(15)))))->toNumber())->value > 0 ? m0f14(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f15\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f16(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(16)))))->toNumber())->value > 0 ? m0f15(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f16\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f17(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(17)))))->toNumber())->value > 0 ? m0f16(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f17\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f18(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(18)))))->toNumber())->value > 0 ? m0f17(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f18\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f19(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(19)))))->toNumber())->value > 0 ? m0f18(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f19\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f20(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(20)))))->toNumber())->value > 0 ? m0f19(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f20\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f21(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(21)))))->toNumber())->value > 0 ? m0f20(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f21\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f22(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(22)))))->toNumber())->value > 0 ? m0f21(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f22\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f23(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(23)))))->toNumber())->value > 0 ? m0f22(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f23\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f24(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(24)))))->toNumber())->value > 0 ? m0f23(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f24\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f25(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(25)))))->toNumber())->value > 0 ? m0f24(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f25\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f26(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(26)))))->toNumber())->value > 0 ? m0f25(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f26\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f27(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(27)))))->toNumber())->value > 0 ? m0f26(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f27\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f28(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(28)))))->toNumber())->value > 0 ? m0f27(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f28\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f29(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(29)))))->toNumber())->value > 0 ? m0f28(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f29\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f30(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(30)))))->toNumber())->value > 0 ? m0f29(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f30\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f31(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(31)))))->toNumber())->value > 0 ? m0f30(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f31\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f32(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(32)))))->toNumber())->value > 0 ? m0f31(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f32\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f33(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(33)))))->toNumber())->value > 0 ? m0f32(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f33\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f34(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(34)))))->toNumber())->value > 0 ? m0f33(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f34\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f35(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(35)))))->toNumber())->value > 0 ? m0f34(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f35\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f36(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(36)))))->toNumber())->value > 0 ? m0f35(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f36\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f37(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(37)))))->toNumber())->value > 0 ? m0f36(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f37\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f38(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(38)))))->toNumber())->value > 0 ? m0f37(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f38\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f39(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(39)))))->toNumber())->value > 0 ? m0f38(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f39\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f40(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(40)))))->toNumber())->value > 0 ? m0f39(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f40\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f41(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(41)))))->toNumber())->value > 0 ? m0f40(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f41\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f42(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(42)))))->toNumber())->value > 0 ? m0f41(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f42\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f43(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(43)))))->toNumber())->value > 0 ? m0f42(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f43\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f44(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(44)))))->toNumber())->value > 0 ? m0f43(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f44\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f45(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(45)))))->toNumber())->value > 0 ? m0f44(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f45\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f46(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(46)))))->toNumber())->value > 0 ? m0f45(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f46\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f47(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(47)))))->toNumber())->value > 0 ? m0f46(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f47\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f48(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(48)))))->toNumber())->value > 0 ? m0f47(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f48\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f49(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(49)))))->toNumber())->value > 0 ? m0f48(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f49\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f50(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(50)))))->toNumber())->value > 0 ? m0f49(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f50\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f51(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(51)))))->toNumber())->value > 0 ? m0f50(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f51\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f52(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(52)))))->toNumber())->value > 0 ? m0f51(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f52\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f53(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(53)))))->toNumber())->value > 0 ? m0f52(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f53\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f54(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(54)))))->toNumber())->value > 0 ? m0f53(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f54\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f55(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(55)))))->toNumber())->value > 0 ? m0f54(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f55\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f56(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(56)))))->toNumber())->value > 0 ? m0f55(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f56\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f57(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(57)))))->toNumber())->value > 0 ? m0f56(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f57\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f58(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(58)))))->toNumber())->value > 0 ? m0f57(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f58\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f59(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(59)))))->toNumber())->value > 0 ? m0f58(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f59\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f60(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(60)))))->toNumber())->value > 0 ? m0f59(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f60\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f61(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(61)))))->toNumber())->value > 0 ? m0f60(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f61\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f62(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(62)))))->toNumber())->value > 0 ? m0f61(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f62\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f63(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(63)))))->toNumber())->value > 0 ? m0f62(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f63\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f64(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(64)))))->toNumber())->value > 0 ? m0f63(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f64\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f65(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(65)))))->toNumber())->value > 0 ? m0f64(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f65\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f66(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(66)))))->toNumber())->value > 0 ? m0f65(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f66\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f67(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(67)))))->toNumber())->value > 0 ? m0f66(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f67\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f68(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(68)))))->toNumber())->value > 0 ? m0f67(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f68\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f69(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(69)))))->toNumber())->value > 0 ? m0f68(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f69\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f70(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(70)))))->toNumber())->value > 0 ? m0f69(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f70\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f71(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(71)))))->toNumber())->value > 0 ? m0f70(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f71\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f72(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(72)))))->toNumber())->value > 0 ? m0f71(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f72\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f73(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(73)))))->toNumber())->value > 0 ? m0f72(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f73\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f74(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(74)))))->toNumber())->value > 0 ? m0f73(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f74\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f75(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(75)))))->toNumber())->value > 0 ? m0f74(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f75\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f76(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(76)))))->toNumber())->value > 0 ? m0f75(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f76\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f77(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(77)))))->toNumber())->value > 0 ? m0f76(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f77\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f78(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(78)))))->toNumber())->value > 0 ? m0f77(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f78\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f79(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(79)))))->toNumber())->value > 0 ? m0f78(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f79\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f80(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(80)))))->toNumber())->value > 0 ? m0f79(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f80\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f81(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(81)))))->toNumber())->value > 0 ? m0f80(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f81\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f82(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(82)))))->toNumber())->value > 0 ? m0f81(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f82\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f83(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(83)))))->toNumber())->value > 0 ? m0f82(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f83\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f84(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(84)))))->toNumber())->value > 0 ? m0f83(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f84\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f85(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(85)))))->toNumber())->value > 0 ? m0f84(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f85\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f86(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(86)))))->toNumber())->value > 0 ? m0f85(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f86\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f87(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(87)))))->toNumber())->value > 0 ? m0f86(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f87\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f88(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(88)))))->toNumber())->value > 0 ? m0f87(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f88\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f89(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(89)))))->toNumber())->value > 0 ? m0f88(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f89\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f90(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(90)))))->toNumber())->value > 0 ? m0f89(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f90\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f91(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(91)))))->toNumber())->value > 0 ? m0f90(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f91\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f92(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(92)))))->toNumber())->value > 0 ? m0f91(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f92\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f93(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(93)))))->toNumber())->value > 0 ? m0f92(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f93\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f94(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(94)))))->toNumber())->value > 0 ? m0f93(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f94\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f95(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(95)))))->toNumber())->value > 0 ? m0f94(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f95\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f96(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(96)))))->toNumber())->value > 0 ? m0f95(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f96\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f97(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(97)))))->toNumber())->value > 0 ? m0f96(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f97\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f98(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(98)))))->toNumber())->value > 0 ? m0f97(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f98\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f99(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(99)))))->toNumber())->value > 0 ? m0f98(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f99\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
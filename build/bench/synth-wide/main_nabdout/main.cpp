@@ -0,0 +1,25 @@
+#include <Variable.hpp>
+#include <std.hpp>
+#include <mod3.hpp>
+VariablePointer fake_main(const VariablePointer &args);
+VariablePointer fake_main(const VariablePointer &args) {
+    return m3f19(std::make_shared<NumberVariable>(3));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
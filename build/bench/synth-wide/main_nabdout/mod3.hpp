@@ -0,0 +1,23 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer m3f0(const VariablePointer &x);
+VariablePointer m3f1(const VariablePointer &x);
+VariablePointer m3f2(const VariablePointer &x);
+VariablePointer m3f3(const VariablePointer &x);
+VariablePointer m3f4(const VariablePointer &x);
+VariablePointer m3f5(const VariablePointer &x);
+VariablePointer m3f6(const VariablePointer &x);
+VariablePointer m3f7(const VariablePointer &x);
+VariablePointer m3f8(const VariablePointer &x);
+VariablePointer m3f9(const VariablePointer &x);
+VariablePointer m3f10(const VariablePointer &x);
+VariablePointer m3f11(const VariablePointer &x);
+VariablePointer m3f12(const VariablePointer &x);
+VariablePointer m3f13(const VariablePointer &x);
+VariablePointer m3f14(const VariablePointer &x);
+VariablePointer m3f15(const VariablePointer &x);
+VariablePointer m3f16(const VariablePointer &x);
+VariablePointer m3f17(const VariablePointer &x);
+VariablePointer m3f18(const VariablePointer &x);
+VariablePointer m3f19(const VariablePointer &x);
+
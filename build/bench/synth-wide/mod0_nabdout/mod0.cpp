@@ -0,0 +1,82 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer m0f0(const VariablePointer &x);
+VariablePointer m0f1(const VariablePointer &x);
+VariablePointer m0f2(const VariablePointer &x);
+VariablePointer m0f3(const VariablePointer &x);
+VariablePointer m0f4(const VariablePointer &x);
+VariablePointer m0f5(const VariablePointer &x);
+VariablePointer m0f6(const VariablePointer &x);
+VariablePointer m0f7(const VariablePointer &x);
+VariablePointer m0f8(const VariablePointer &x);
+VariablePointer m0f9(const VariablePointer &x);
+VariablePointer m0f10(const VariablePointer &x);
+VariablePointer m0f11(const VariablePointer &x);
+VariablePointer m0f12(const VariablePointer &x);
+VariablePointer m0f13(const VariablePointer &x);
+VariablePointer m0f14(const VariablePointer &x);
+VariablePointer m0f15(const VariablePointer &x);
+VariablePointer m0f16(const VariablePointer &x);
+VariablePointer m0f17(const VariablePointer &x);
+VariablePointer m0f18(const VariablePointer &x);
+VariablePointer m0f19(const VariablePointer &x);
+VariablePointer m0f0(const VariablePointer &x) {
+    return print(x);
+}
+VariablePointer m0f1(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(1)))))->toNumber())->value > 0 ? m0f0(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f1\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f2(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))->toNumber())->value > 0 ? m0f1(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f2\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f3(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(3)))))->toNumber())->value > 0 ? m0f2(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f3\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f4(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(4)))))->toNumber())->value > 0 ? m0f3(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f4\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f5(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(5)))))->toNumber())->value > 0 ? m0f4(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f5\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f6(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(6)))))->toNumber())->value > 0 ? m0f5(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f6\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f7(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(7)))))->toNumber())->value > 0 ? m0f6(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f7\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f8(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(8)))))->toNumber())->value > 0 ? m0f7(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f8\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f9(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(9)))))->toNumber())->value > 0 ? m0f8(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f9\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f10(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))->toNumber())->value > 0 ? m0f9(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f10\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f11(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(11)))))->toNumber())->value > 0 ? m0f10(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f11\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f12(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(12)))))->toNumber())->value > 0 ? m0f11(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f12\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f13(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(13)))))->toNumber())->value > 0 ? m0f12(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f13\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f14(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(14)))))->toNumber())->value > 0 ? m0f13(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f14\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f15(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(15)))))->toNumber())->value > 0 ? m0f14(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f15\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f16(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(16)))))->toNumber())->value > 0 ? m0f15(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f16\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f17(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(17)))))->toNumber())->value > 0 ? m0f16(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f17\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f18(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(18)))))->toNumber())->value > 0 ? m0f17(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f18\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m0f19(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(19)))))->toNumber())->value > 0 ? m0f18(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m0f19\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer m0f0(const VariablePointer &x);
+VariablePointer m0f1(const VariablePointer &x);
+VariablePointer m0f2(const VariablePointer &x);
+VariablePointer m0f3(const VariablePointer &x);
+VariablePointer m0f4(const VariablePointer &x);
+VariablePointer m0f5(const VariablePointer &x);
+VariablePointer m0f6(const VariablePointer &x);
+VariablePointer m0f7(const VariablePointer &x);
+VariablePointer m0f8(const VariablePointer &x);
+VariablePointer m0f9(const VariablePointer &x);
+VariablePointer m0f10(const VariablePointer &x);
+VariablePointer m0f11(const VariablePointer &x);
+VariablePointer m0f12(const VariablePointer &x);
+VariablePointer m0f13(const VariablePointer &x);
+VariablePointer m0f14(const VariablePointer &x);
+VariablePointer m0f15(const VariablePointer &x);
+VariablePointer m0f16(const VariablePointer &x);
+VariablePointer m0f17(const VariablePointer &x);
+VariablePointer m0f18(const VariablePointer &x);
+VariablePointer m0f19(const VariablePointer &x);
+
@@ -0,0 +1,83 @@
+#include <Variable.hpp>
+#include <std.hpp>
+#include <mod0.hpp>
+VariablePointer m1f0(const VariablePointer &x);
+VariablePointer m1f1(const VariablePointer &x);
+VariablePointer m1f2(const VariablePointer &x);
+VariablePointer m1f3(const VariablePointer &x);
+VariablePointer m1f4(const VariablePointer &x);
+VariablePointer m1f5(const VariablePointer &x);
+VariablePointer m1f6(const VariablePointer &x);
+VariablePointer m1f7(const VariablePointer &x);
+VariablePointer m1f8(const VariablePointer &x);
+VariablePointer m1f9(const VariablePointer &x);
+VariablePointer m1f10(const VariablePointer &x);
+VariablePointer m1f11(const VariablePointer &x);
+VariablePointer m1f12(const VariablePointer &x);
+VariablePointer m1f13(const VariablePointer &x);
+VariablePointer m1f14(const VariablePointer &x);
+VariablePointer m1f15(const VariablePointer &x);
+VariablePointer m1f16(const VariablePointer &x);
+VariablePointer m1f17(const VariablePointer &x);
+VariablePointer m1f18(const VariablePointer &x);
+VariablePointer m1f19(const VariablePointer &x);
+VariablePointer m1f0(const VariablePointer &x) {
+    return m0f19(x);
+}
+VariablePointer m1f1(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(1)))))->toNumber())->value > 0 ? m1f0(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f1\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f2(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))->toNumber())->value > 0 ? m1f1(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f2\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f3(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(3)))))->toNumber())->value > 0 ? m1f2(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f3\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f4(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(4)))))->toNumber())->value > 0 ? m1f3(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f4\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f5(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(5)))))->toNumber())->value > 0 ? m1f4(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f5\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f6(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(6)))))->toNumber())->value > 0 ? m1f5(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f6\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f7(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(7)))))->toNumber())->value > 0 ? m1f6(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f7\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f8(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(8)))))->toNumber())->value > 0 ? m1f7(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f8\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f9(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(9)))))->toNumber())->value > 0 ? m1f8(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f9\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f10(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))->toNumber())->value > 0 ? m1f9(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f10\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f11(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(11)))))->toNumber())->value > 0 ? m1f10(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f11\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f12(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(12)))))->toNumber())->value > 0 ? m1f11(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f12\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f13(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(13)))))->toNumber())->value > 0 ? m1f12(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f13\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f14(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(14)))))->toNumber())->value > 0 ? m1f13(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f14\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f15(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(15)))))->toNumber())->value > 0 ? m1f14(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f15\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f16(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(16)))))->toNumber())->value > 0 ? m1f15(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f16\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f17(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(17)))))->toNumber())->value > 0 ? m1f16(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f17\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f18(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(18)))))->toNumber())->value > 0 ? m1f17(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f18\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m1f19(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(19)))))->toNumber())->value > 0 ? m1f18(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m1f19\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
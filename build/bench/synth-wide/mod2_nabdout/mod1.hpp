@@ -0,0 +1,23 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer m1f0(const VariablePointer &x);
+VariablePointer m1f1(const VariablePointer &x);
+VariablePointer m1f2(const VariablePointer &x);
+VariablePointer m1f3(const VariablePointer &x);
+VariablePointer m1f4(const VariablePointer &x);
+VariablePointer m1f5(const VariablePointer &x);
+VariablePointer m1f6(const VariablePointer &x);
+VariablePointer m1f7(const VariablePointer &x);
+VariablePointer m1f8(const VariablePointer &x);
+VariablePointer m1f9(const VariablePointer &x);
+VariablePointer m1f10(const VariablePointer &x);
+VariablePointer m1f11(const VariablePointer &x);
+VariablePointer m1f12(const VariablePointer &x);
+VariablePointer m1f13(const VariablePointer &x);
+VariablePointer m1f14(const VariablePointer &x);
+VariablePointer m1f15(const VariablePointer &x);
+VariablePointer m1f16(const VariablePointer &x);
+VariablePointer m1f17(const VariablePointer &x);
+VariablePointer m1f18(const VariablePointer &x);
+VariablePointer m1f19(const VariablePointer &x);
+
@@ -0,0 +1,83 @@
+#include <Variable.hpp>
+#include <std.hpp>
+#include <mod1.hpp>
+VariablePointer m2f0(const VariablePointer &x);
+VariablePointer m2f1(const VariablePointer &x);
+VariablePointer m2f2(const VariablePointer &x);
+VariablePointer m2f3(const VariablePointer &x);
+VariablePointer m2f4(const VariablePointer &x);
+VariablePointer m2f5(const VariablePointer &x);
+VariablePointer m2f6(const VariablePointer &x);
+VariablePointer m2f7(const VariablePointer &x);
+VariablePointer m2f8(const VariablePointer &x);
+VariablePointer m2f9(const VariablePointer &x);
+VariablePointer m2f10(const VariablePointer &x);
+VariablePointer m2f11(const VariablePointer &x);
+VariablePointer m2f12(const VariablePointer &x);
+VariablePointer m2f13(const VariablePointer &x);
+VariablePointer m2f14(const VariablePointer &x);
+VariablePointer m2f15(const VariablePointer &x);
+VariablePointer m2f16(const VariablePointer &x);
+VariablePointer m2f17(const VariablePointer &x);
+VariablePointer m2f18(const VariablePointer &x);
+VariablePointer m2f19(const VariablePointer &x);
+VariablePointer m2f0(const VariablePointer &x) {
+    return m1f19(x);
+}
+VariablePointer m2f1(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(1)))))->toNumber())->value > 0 ? m2f0(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f1\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f2(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))->toNumber())->value > 0 ? m2f1(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f2\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f3(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(3)))))->toNumber())->value > 0 ? m2f2(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f3\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f4(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(4)))))->toNumber())->value > 0 ? m2f3(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f4\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f5(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(5)))))->toNumber())->value > 0 ? m2f4(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f5\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f6(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(6)))))->toNumber())->value > 0 ? m2f5(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f6\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f7(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(7)))))->toNumber())->value > 0 ? m2f6(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f7\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f8(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(8)))))->toNumber())->value > 0 ? m2f7(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f8\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f9(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(9)))))->toNumber())->value > 0 ? m2f8(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f9\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f10(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))->toNumber())->value > 0 ? m2f9(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f10\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f11(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(11)))))->toNumber())->value > 0 ? m2f10(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f11\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f12(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(12)))))->toNumber())->value > 0 ? m2f11(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f12\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f13(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(13)))))->toNumber())->value > 0 ? m2f12(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f13\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f14(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(14)))))->toNumber())->value > 0 ? m2f13(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f14\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f15(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(15)))))->toNumber())->value > 0 ? m2f14(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f15\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f16(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(16)))))->toNumber())->value > 0 ? m2f15(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f16\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f17(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(17)))))->toNumber())->value > 0 ? m2f16(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f17\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f18(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(18)))))->toNumber())->value > 0 ? m2f17(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f18\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m2f19(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(19)))))->toNumber())->value > 0 ? m2f18(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m2f19\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer m2f0(const VariablePointer &x);
+VariablePointer m2f1(const VariablePointer &x);
+VariablePointer m2f2(const VariablePointer &x);
+VariablePointer m2f3(const VariablePointer &x);
+VariablePointer m2f4(const VariablePointer &x);
+VariablePointer m2f5(const VariablePointer &x);
+VariablePointer m2f6(const VariablePointer &x);
+VariablePointer m2f7(const VariablePointer &x);
+VariablePointer m2f8(const VariablePointer &x);
+VariablePointer m2f9(const VariablePointer &x);
+VariablePointer m2f10(const VariablePointer &x);
+VariablePointer m2f11(const VariablePointer &x);
+VariablePointer m2f12(const VariablePointer &x);
+VariablePointer m2f13(const VariablePointer &x);
+VariablePointer m2f14(const VariablePointer &x);
+VariablePointer m2f15(const VariablePointer &x);
+VariablePointer m2f16(const VariablePointer &x);
+VariablePointer m2f17(const VariablePointer &x);
+VariablePointer m2f18(const VariablePointer &x);
+VariablePointer m2f19(const VariablePointer &x);
+
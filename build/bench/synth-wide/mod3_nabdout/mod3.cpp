@@ -0,0 +1,83 @@
+#include <Variable.hpp>
+#include <std.hpp>
+#include <mod2.hpp>
+VariablePointer m3f0(const VariablePointer &x);
+VariablePointer m3f1(const VariablePointer &x);
+VariablePointer m3f2(const VariablePointer &x);
+VariablePointer m3f3(const VariablePointer &x);
+VariablePointer m3f4(const VariablePointer &x);
+VariablePointer m3f5(const VariablePointer &x);
+VariablePointer m3f6(const VariablePointer &x);
+VariablePointer m3f7(const VariablePointer &x);
+VariablePointer m3f8(const VariablePointer &x);
+VariablePointer m3f9(const VariablePointer &x);
+VariablePointer m3f10(const VariablePointer &x);
+VariablePointer m3f11(const VariablePointer &x);
+VariablePointer m3f12(const VariablePointer &x);
+VariablePointer m3f13(const VariablePointer &x);
+VariablePointer m3f14(const VariablePointer &x);
+VariablePointer m3f15(const VariablePointer &x);
+VariablePointer m3f16(const VariablePointer &x);
+VariablePointer m3f17(const VariablePointer &x);
+VariablePointer m3f18(const VariablePointer &x);
+VariablePointer m3f19(const VariablePointer &x);
+VariablePointer m3f0(const VariablePointer &x) {
+    return m2f19(x);
+}
+VariablePointer m3f1(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(1)))))->toNumber())->value > 0 ? m3f0(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f1\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f2(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(2)))))->toNumber())->value > 0 ? m3f1(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f2\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f3(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(3)))))->toNumber())->value > 0 ? m3f2(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f3\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f4(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(4)))))->toNumber())->value > 0 ? m3f3(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f4\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f5(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(5)))))->toNumber())->value > 0 ? m3f4(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f5\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f6(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(6)))))->toNumber())->value > 0 ? m3f5(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f6\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f7(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(7)))))->toNumber())->value > 0 ? m3f6(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f7\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f8(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(8)))))->toNumber())->value > 0 ? m3f7(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f8\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f9(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(9)))))->toNumber())->value > 0 ? m3f8(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f9\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f10(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(10)))))->toNumber())->value > 0 ? m3f9(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f10\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f11(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(11)))))->toNumber())->value > 0 ? m3f10(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f11\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f12(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(12)))))->toNumber())->value > 0 ? m3f11(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f12\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f13(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(13)))))->toNumber())->value > 0 ? m3f12(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f13\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f14(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(14)))))->toNumber())->value > 0 ? m3f13(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f14\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f15(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(15)))))->toNumber())->value > 0 ? m3f14(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f15\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f16(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(16)))))->toNumber())->value > 0 ? m3f15(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f16\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f17(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(17)))))->toNumber())->value > 0 ? m3f16(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f17\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f18(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(18)))))->toNumber())->value > 0 ? m3f17(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f18\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
+VariablePointer m3f19(const VariablePointer &x) {
+    return std::dynamic_pointer_cast<NumberVariable>(gt(std::make_shared<TupleVariable>(std::make_pair<VariablePointer, VariablePointer>(std::dynamic_pointer_cast<Variable>(x), std::dynamic_pointer_cast<Variable>(std::make_shared<NumberVariable>(19)))))->toNumber())->value > 0 ? m3f18(dec(x)) : std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(std::make_shared<StringVariable>("m3f19\n"))), std::dynamic_pointer_cast<Variable>(inc(x)),  }));
+}
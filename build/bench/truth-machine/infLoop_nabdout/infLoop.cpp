@@ -0,0 +1,6 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer i1InfI0Stop(const VariablePointer &loop);
+VariablePointer i1InfI0Stop(const VariablePointer &loop) {
+    return std::dynamic_pointer_cast<NumberVariable>(loop->toNumber())->value > 0 ? i1InfI0Stop(print(std::make_shared<NumberVariable>(1))) : print(std::make_shared<NumberVariable>(static_cast<double>(0x0)));
+}
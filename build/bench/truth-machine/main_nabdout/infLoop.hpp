@@ -0,0 +1,4 @@
+#pragma once
+#include <Variable.hpp>
+VariablePointer i1InfI0Stop(const VariablePointer &loop);
+
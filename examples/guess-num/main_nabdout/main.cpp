@@ -0,0 +1,160 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer startGame(const VariablePointer &randNum);
+VariablePointer startGame__num(const double randNum);
+VariablePointer guessFor(const VariablePointer &numAndAttempts);
+VariablePointer checkGuess(const VariablePointer &inputAndTupNumAtt);
+VariablePointer checkGuess__tup(const VariablePointer &inputAndTupNumAtt__fst, const VariablePointer &inputAndTupNumAtt__snd);
+VariablePointer fake_main(const VariablePointer &args);
+static const VariablePointer lit0 = std::make_shared<StringVariable>("Guess a number btwn 0 and 10: ");
+static const VariablePointer lit1 = std::make_shared<NumberVariable>(2);
+static const VariablePointer lit2 = std::make_shared<StringVariable>("The answer was ");
+static const VariablePointer lit3 = std::make_shared<StringVariable>("\nEnter \'1\' to play again or \'0\' to quit: ");
+static const VariablePointer lit4 = std::make_shared<NumberVariable>(0);
+static const VariablePointer lit5 = std::make_shared<NumberVariable>(10);
+static const VariablePointer lit6 = std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>(lit4, lit5));
+static const VariablePointer lit7 = std::make_shared<StringVariable>("Guess (integer): ");
+static const VariablePointer lit8 = std::make_shared<StringVariable>("You won!\n");
+static const VariablePointer lit9 = std::make_shared<StringVariable>("Too high!\n");
+static const VariablePointer lit10 = std::make_shared<StringVariable>("Too low!\n");
+static const VariablePointer lit11 = std::make_shared<StringVariable>("You lose!\n");
+static const VariablePointer lit12 = std::make_shared<NumberVariable>(static_cast<double>(0x0));
+static const VariablePointer lit13 = std::make_shared<StringVariable>("Welcome to Guess the Number!\n");
+VariablePointer startGame__num__tail(int tcase, VariablePointer tvar, double tnum);
+VariablePointer guessFor__tail(int tcase, VariablePointer tvar, double tnum, VariablePointer tsecond);
+VariablePointer startGame(const VariablePointer &randNum) {
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_4 = print(lit0);
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_3 = guessFor(std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>{ randNum, lit1 }));
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_2 = print(lit2);
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_1 = print(randNum);
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_0 = print(lit3);
+    return std::static_pointer_cast<NumberVariable>(parseNum(input(lit4)))->value > 0 ? std::dynamic_pointer_cast<Variable>(startGame__num(std::static_pointer_cast<NumberVariable>(round(random(lit6)))->value)) : std::dynamic_pointer_cast<Variable>(lit4);
+}();
+}();
+}();
+}();
+}();
+}
+VariablePointer startGame__num(const double randNum) {
+    return startGame__num__tail(0, VariablePointer(), randNum);
+}
+VariablePointer startGame__num__tail(int tcase, VariablePointer tvar, double tnum) {
+    while(true) {
+        switch(tcase) {
+            case 0: {
+                const double randNum = tnum;
+                [[maybe_unused]] const VariablePointer s_4 = print(lit0);
+                const VariablePointer t0 = std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>(std::make_shared<NumberVariable>(randNum), lit1));
+                [[maybe_unused]] const VariablePointer s_3 = guessFor(t0);
+                [[maybe_unused]] const VariablePointer s_2 = print(lit2);
+                [[maybe_unused]] const VariablePointer s_1 = print(std::make_shared<NumberVariable>(randNum));
+                [[maybe_unused]] const VariablePointer s_0 = print(lit3);
+                const VariablePointer t1 = input(lit4);
+                const VariablePointer t2 = parseNum(t1);
+                if(std::static_pointer_cast<NumberVariable>(t2)->value > 0) {
+                    const VariablePointer t3 = random(lit6);
+                    const VariablePointer t4 = round(t3);
+                    tnum = std::static_pointer_cast<NumberVariable>(t4)->value;
+                    tcase = 0;
+                    continue;
+                } else {
+                    return lit4;
+                }
+            }
+        }
+    }
+}
+VariablePointer guessFor(const VariablePointer &numAndAttempts) {
+    return guessFor__tail(0, numAndAttempts, 0, VariablePointer());
+}
+VariablePointer guessFor__tail(int tcase, VariablePointer tvar, double tnum, VariablePointer tsecond) {
+    while(true) {
+        switch(tcase) {
+            case 0: {
+                const VariablePointer &numAndAttempts = tvar;
+                [[maybe_unused]] const VariablePointer s_5 = print(lit7);
+                const VariablePointer t0 = input(lit4);
+                const VariablePointer t1 = parseNum(t0);
+                const VariablePointer t2 = numAndAttempts;
+                tvar = t1;
+                tsecond = t2;
+                tcase = 1;
+                continue;
+            }
+            case 1: {
+                [[maybe_unused]] const VariablePointer &inputAndTupNumAtt__fst = tvar;
+                [[maybe_unused]] const VariablePointer &inputAndTupNumAtt__snd = tsecond;
+                [[maybe_unused]] const VariablePointer c_2 = inputAndTupNumAtt__fst;
+                [[maybe_unused]] const VariablePointer c_1 = inputAndTupNumAtt__snd;
+                [[maybe_unused]] const VariablePointer c_0 = fst(c_1);
+                const double t0 = (numberValue(c_2) == numberValue(c_0) ? 1.0 : -1.0);
+                if(t0 > 0) {
+                    return print(lit8);
+                } else {
+                    [[maybe_unused]] const VariablePointer c_3 = snd(c_1);
+                    if(numberValue(c_3) > 0) {
+                        const double t1 = (numberValue(c_2) > numberValue(c_0) ? 1.0 : -1.0);
+                        if(t1 > 0) {
+                            [[maybe_unused]] const VariablePointer s_6 = print(lit9);
+                            const VariablePointer t2 = std::make_shared<NumberVariable>((numberValue(c_3) - 1));
+                            const VariablePointer t3 = std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>(c_0, t2));
+                            tvar = t3;
+                            tcase = 0;
+                            continue;
+                        } else {
+                            [[maybe_unused]] const VariablePointer s_7 = print(lit10);
+                            const VariablePointer t4 = std::make_shared<NumberVariable>((numberValue(c_3) - 1));
+                            const VariablePointer t5 = std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>(c_0, t4));
+                            tvar = t5;
+                            tcase = 0;
+                            continue;
+                        }
+                    } else {
+                        return print(lit11);
+                    }
+                }
+            }
+        }
+    }
+}
+VariablePointer checkGuess(const VariablePointer &inputAndTupNumAtt) {
+    return guessFor__tail(1, fst(inputAndTupNumAtt), 0, snd(inputAndTupNumAtt));
+}
+VariablePointer checkGuess__tup(const VariablePointer &inputAndTupNumAtt__fst, const VariablePointer &inputAndTupNumAtt__snd) {
+    return guessFor__tail(1, inputAndTupNumAtt__fst, 0, inputAndTupNumAtt__snd);
+}
+VariablePointer fake_main(const VariablePointer &args) {
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_10 = [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_9 = seedRandom(lit12);
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer s_8 = print(lit13);
+    return startGame__num(std::static_pointer_cast<NumberVariable>(round(random(lit6)))->value);
+}();
+}();
+    return lit4;
+}();
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
@@ -0,0 +1,26 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer i1InfI0Stop(const VariablePointer &loop);
+static const VariablePointer lit0 = std::make_shared<StringVariable>("1.000000");
+static const VariablePointer lit1 = std::make_shared<StringVariable>("0.000000");
+VariablePointer i1InfI0Stop__tail(int tcase, VariablePointer tvar, double tnum);
+VariablePointer i1InfI0Stop(const VariablePointer &loop) {
+    return i1InfI0Stop__tail(0, loop, 0);
+}
+VariablePointer i1InfI0Stop__tail(int tcase, VariablePointer tvar, double tnum) {
+    while(true) {
+        switch(tcase) {
+            case 0: {
+                const VariablePointer &loop = tvar;
+                if(numberValue(loop) > 0) {
+                    const VariablePointer t0 = print(lit0);
+                    tvar = t0;
+                    tcase = 0;
+                    continue;
+                } else {
+                    return print(lit1);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include <Variable.hpp>
+// Inline interface hash: cbf29ce484222325
+VariablePointer i1InfI0Stop(const VariablePointer &loop);
+
@@ -0,0 +1,26 @@
+#include <Variable.hpp>
+#include <std.hpp>
+#include <infLoop.hpp>
+VariablePointer fake_main(const VariablePointer &args);
+static const VariablePointer lit0 = std::make_shared<NumberVariable>(0);
+VariablePointer fake_main(const VariablePointer &args) {
+    return i1InfI0Stop(parseNum(input(lit0)));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
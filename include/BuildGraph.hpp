@@ -0,0 +1,56 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Discovers every module a program is built from by following includes
+ *  - Writes whole-program build files (build.ninja, compile_commands.json)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Token.hpp>
+#include <FileIo.hpp>
+
+namespace nabd {
+    struct ModuleNode {
+        ModuleInfo modInfo;
+        std::vector<std::string> includeFolders;
+        std::vector<std::string> dependencies;
+        size_t shardCount; // Set once translated, see codegen::ModuleCode
+    };
+
+    /*
+     * Walks the nabd includes of the program starting at inputs.fileName.
+     * Only parses, so shardCount is left at 0
+     */
+    std::vector<ModuleNode> collectModules(const InputArguments &inputs);
+
+    // Every file the generated C++ of a module depends on (itself + includes)
+    std::vector<std::string> moduleDependencies(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo
+    );
+
+    std::string generateDepFile(
+        const std::string &target, const std::vector<std::string> &deps
+    );
+
+    std::string generateNinjaFile(
+        const InputArguments &inputs, const std::string &nabcPath,
+        const std::vector<ModuleNode> &modules
+    );
+    std::string generateCompileCommands(
+        const InputArguments &inputs, const std::vector<ModuleNode> &modules
+    );
+
+    /*
+     * Translates every module (once each, which is what gives the shard
+     * counts), then does all of the above and writes the files to the
+     * current directory. Regenerating the build file retranslates
+     */
+    void emitNinjaBuild(
+        const InputArguments &inputs, const std::string &nabcPath
+    );
+}
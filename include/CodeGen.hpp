@@ -10,28 +10,140 @@
 
 #include <string>
 #include <vector>
+#include <set>
 #include <Token.hpp>
+#include <FileIo.hpp>
+#include <TypeInfer.hpp>
+#include <TailCalls.hpp>
 
 namespace nabd {
     namespace codegen {
+        /*
+         * Big modules are split into several translation units (shards) so
+         * g++ can build them in parallel. They share a generated header
+         * (declarations) holding the includes and every forward declaration
+         */
+        struct ModuleCode {
+            std::string declarations; // Empty when there's only one shard
+            std::vector<std::string> shards;
+        };
+
+        // <module>, or <module>_shard<n> when sharded. Add .cpp, .o, etc
+        std::string shardName(
+            const ModuleInfo &modInfo,
+            const size_t shard, const size_t shardCount
+        );
+        std::string declarationsName(const ModuleInfo &modInfo);
+
+        // Picks the shard count from the number of definitions and code size
+        ModuleCode generateModuleCode(
+            const Token &program,
+            const InputArguments &cliInputs,
+            const ModuleInfo &modInfo
+        );
+        ModuleCode generateModuleCode(
+            const Token &program,
+            const InputArguments &cliInputs,
+            const ModuleInfo &modInfo,
+            const size_t shardCount
+        );
+
+        // The whole module as one translation unit (C with --backend c)
         std::string generateCppCode(
             const Token &program,
             const InputArguments &cliInputs,
             const ModuleInfo &modInfo
         );
 
+        // Headers generated for nabd modules only declare what's called
         std::string generateIncludeCode(
-            const Token &include,
+            const Token &include, const std::set<std::string> &called,
+            const InputArguments &cliInputs,
+            const ModuleInfo &modInfo
+        );
+
+        /*
+         * These append to out rather than building up strings of their own.
+         * Function bodies are normally one nested C++ expression, but deep
+         * ones (or all of them with --anf) are lowered to one statement per
+         * call, tuple and list by generateAnfCode instead.
+         * Where types says an expression is a number, it's worked out on
+         * plain doubles and only boxed when it's passed on or returned
+         */
+        void generateFuncDefCode(
+            const Token &funcDef, const InputArguments &cliInputs,
+            const types::TypeContext &types, std::string &out
+        );
+        void generateExprCode(
+            const Token &expr, const types::TypeContext &types,
+            std::string &out
+        );
+
+        /*
+         * The same function taking its parameter as a plain double, which
+         * calls passing a known number use instead. The generic one stays
+         * for everything else (and for other modules)
+         */
+        void generateNumberCloneCode(
+            const Token &funcDef, const InputArguments &cliInputs,
+            const types::TypeContext &types, std::string &out
+        );
+
+        /*
+         * The same function taking the halves of its parameter separately,
+         * which calls passing a tuple literal use instead of building it
+         */
+        void generateTupleCloneCode(
+            const Token &funcDef, const InputArguments &cliInputs,
+            const types::TypeContext &types, std::string &out
+        );
+        void generateAnfCode(
+            const Token &funcDef, const types::TypeContext &types,
+            std::string &out
+        );
+
+        // A double expression for expr's value converted to a number
+        void generateNumberCode(
+            const Token &expr, const types::TypeContext &types,
+            std::string &out
+        );
+
+        // How many expressions deep the deepest part of expr is
+        size_t exprDepth(const Token &expr);
+
+        // A name for temporaries that no identifier in funcDef starts with
+        std::string tempPrefix(const Token &funcDef);
+        std::string tempPrefix(const std::vector<const Token *> &funcDefs);
+
+        /*
+         * The loop a group of tail calling functions runs in. Each member
+         * is a case of a switch, and tail calls within the group set the
+         * argument and case and go round again rather than calling
+         */
+        void generateTailGroupCode(
+            const tailcalls::TailGroups &tail, const size_t groupInd,
+            const types::TypeContext &types, std::string &out
+        );
+
+        /*
+         * The plain C backend (--backend c, see CCodeGen.cpp). Modules are
+         * always one translation unit built against the C runtime rather
+         * than Variable.hpp. generateModuleCode hands off to it
+         */
+        ModuleCode generateCModuleCode(
+            const Token &program,
             const InputArguments &cliInputs,
             const ModuleInfo &modInfo
         );
+        void generateCFuncDefCode(const Token &funcDef, std::string &out);
 
-        std::string generateFuncDefCode(const Token &funcDef);
-        std::string generateExprCode(const Token &expr);
+        // ".c" for the C backend and ".cpp" otherwise
+        std::string sourceExtension(const InputArguments &cliInputs);
 
         // This assumes a file is known to exist and is a .nabd file
         void generateHeaderFile(
             const std::string &moduleFile, const std::string &newFileNameBase,
+            const std::set<std::string> &called,
             const InputArguments &cliInputs,
             const ModuleInfo &modInfo
         );
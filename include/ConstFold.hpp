@@ -0,0 +1,47 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Works out calls to std's pure functions when their arguments are
+ *    constants, so the program does it once while compiling
+ *  - Also runs calls to the module's pure functions (ones that never
+ *    print, read input or use random numbers) with constant arguments
+ *  - Results follow the conversion rules in lib/src/Variable.cpp
+ */
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+
+namespace nabd {
+    namespace folding {
+        /*
+         * A copy of program where constant calls to the comparisons,
+         * inc/dec, round/floor/ceil, fst/snd, dup, len and elem are
+         * replaced by literals, as are ternaries with a constant condition
+         * (by the arm taken). A constant argument to print is turned into
+         * the string it prints.
+         * Calls to pure user functions are replaced by their result too,
+         * unless working it out takes too long (or it's too big)
+         */
+        Token foldConstants(
+            const Token &program, const types::TypeContext &ctx
+        );
+
+        /*
+         * Evaluating it can't print, read input or depend on the random
+         * seed, and is sure to finish
+         */
+        bool isPure(const Token &expr, const types::TypeContext &ctx);
+
+        /*
+         * The module's functions that never (even through other functions)
+         * print, read input or use random numbers, by name
+         */
+        std::map<std::string, const Token *> findPureFuncs(
+            const Token &program, const types::TypeContext &ctx
+        );
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Common subexpression elimination: a pure std call (like the fst and
+ *    snd chains that take apart state tuples) that's worked out more than
+ *    once in a function is worked out once into a temporary (Let)
+ *  - print, input, random and user calls are never merged
+ */
+
+#pragma once
+
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+
+namespace nabd {
+    namespace cse {
+        /*
+         * A copy of program where each function binds the pure calls it
+         * repeats. A call is only moved where it's sure to be worked out
+         * anyway, so ternary arms that don't share it keep their own
+         */
+        Token eliminateCommonSubexprs(
+            const Token &program, const types::TypeContext &ctx
+        );
+    }
+}
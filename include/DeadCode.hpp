@@ -0,0 +1,27 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Drops the definitions a program never reaches from main, which
+ *    inlining and constant folding often leave behind
+ *  - Also finds which functions a module calls, so the headers generated
+ *    for its includes only declare those
+ */
+
+#pragma once
+
+#include <string>
+#include <set>
+#include <Token.hpp>
+
+namespace nabd {
+    namespace deadcode {
+        // The name of every function called somewhere in tok
+        std::set<std::string> calledNames(const Token &tok);
+
+        /*
+         * A copy of program without the functions main can't reach, if it
+         * has a main. Other modules are libraries and keep everything
+         */
+        Token dropUnreachable(const Token &program);
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - The steps of building a module or program, shared by the command line
+ *    compiler, the compile server and watch mode
+ *  - Failures are reported through errorOut (i.e. a CompileError)
+ */
+
+#pragma once
+
+#include <string>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <CodeGen.hpp>
+
+namespace nabd {
+    // Does whatever a single invocation of nabc with these arguments does
+    void runCompiler(InputArguments inputs, const std::string &nabcPath);
+
+    codegen::ModuleCode compile(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo
+    );
+    void translate(
+        const Token &program,
+        const codegen::ModuleCode &code,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo
+    );
+    void buildObj(
+        const codegen::ModuleCode &code,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo
+    );
+    void link(
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo
+    );
+}
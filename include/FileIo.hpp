@@ -17,7 +17,22 @@ namespace nabd {
         std::vector<std::string> includeFolders;
         std::vector<std::string> linkFolders;
         std::vector<std::string> libraryNames;
-        bool link;
+        std::string outputName;
+        std::string socketPath;
+        std::string timingsFile;
+        std::string cCompiler; // --cc, then $NABC_CC, then gcc
+        size_t stackMegabytes = 0; // --stack, 0 keeps the normal stack
+        size_t inlineSize = 16; // --inline, biggest body inlined (0 for none)
+        size_t importInlineSize = 8; // --inline-imports, same for includes
+        size_t memoEntries = 0; // --memoize, results kept per pure function
+        bool link = false;
+        bool emitNinja = false;
+        bool translateOnly = false;
+        bool serve = false;
+        bool watch = false;
+        bool anf = false;
+        bool cBackend = false;
+        bool debug = false;
     };
     InputArguments parseArguments(const int argc, const char **args);
 
@@ -28,14 +43,41 @@ namespace nabd {
         std::string moduleName;
         std::string buildFolder;
     };
-    ModuleInfo extractModuleInfo(const InputArguments &inputs);
+    ModuleInfo moduleInfoFor(const InputArguments &inputs);
+    ModuleInfo extractModuleInfo(const InputArguments &inputs); // Also logs
 
+    // Where an included module lives and whether it's C++ or nabd code
+    struct ModuleLocation {
+        std::string fileName;
+        bool isCpp;
+    };
+    ModuleLocation findModule(
+        const std::string &ident, const InputArguments &inputs
+    );
+
+    /*
+     * Folder holding the compiled standard library (libnabdstd.a), looked for
+     * in the link folders, next to nabc and in nabc's ../lib. "" if not found
+     */
+    std::string findStdLibFolder(const InputArguments &inputs);
+
+    // Builds the module's object from its shards (see CodeGen.hpp)
     std::string generateMakefile(
         const InputArguments &inputs,
-        const ModuleInfo &modInfo
+        const ModuleInfo &modInfo,
+        const std::vector<std::string> &shardNames
     );
 
     extern const std::vector<std::string> g_makeFile;
     extern const std::string g_varHpp;
     extern const std::string g_varCpp;
+
+    // The C backend's equivalents (see CRuntime.cpp)
+    extern const std::vector<std::string> g_cMakeFile;
+    extern const std::string g_cRuntimeH;
+    extern const std::string g_cRuntimeC;
+    extern const std::string g_cStdH;
+
+    // How C modules and the C runtime get compiled
+    std::string cCompileFlags(const InputArguments &inputs);
 }
@@ -0,0 +1,62 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Replaces calls to a module's small functions with their bodies, so
+ *    g++ doesn't have to decide to inline them (it often won't with all
+ *    the shared_ptrs involved), and constant folding sees through them
+ *  - Arguments that can't go straight in are bound to a temporary (Let)
+ *  - Small pure functions of included nabd modules are inlined too. Their
+ *    generated header carries a hash of those bodies, so changing them
+ *    changes the header and the modules using them get rebuilt
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <TypeInfer.hpp>
+
+namespace nabd {
+    namespace inlining {
+        /*
+         * A copy of program where calls to the module's functions that
+         * never recurse (even through others) and have at most maxSize
+         * expressions (--inline), counted after inlining into them, are
+         * replaced by their bodies. So are calls to the exported inlines of
+         * its nabd includes (--inline-imports). 0 turns either off
+         */
+        Token inlineCalls(
+            const Token &program, const types::TypeContext &ctx,
+            const InputArguments &cliInputs
+        );
+
+        /*
+         * The functions of a module that others may inline: ones with at
+         * most maxSize expressions that only call pure std functions
+         */
+        std::vector<Token> exportedInlines(
+            const Token &module, const InputArguments &cliInputs,
+            const size_t maxSize
+        );
+
+        // Changes whenever the exported inlines do (but not their layout)
+        std::string interfaceHash(const std::vector<Token> &funcDefs);
+
+        // expr with each use of name replaced by value
+        Token substitute(
+            const Token &expr, const std::string &name, const Token &value
+        );
+
+        size_t countUses(const Token &expr, const std::string &name);
+
+        /*
+         * start, with _s added until no name in program starts with it, so
+         * temporaries named after it can't hide a parameter or function
+         */
+        std::string letPrefix(
+            const Token &program, const std::string &start
+        );
+    }
+}
@@ -0,0 +1,24 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Keeps parsed modules and include folder listings around between builds
+ *  - Entries are checked against file timestamps, so edits are picked up
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <Token.hpp>
+
+namespace nabd {
+    // Parses a module, or reuses the last parse if the file hasn't changed
+    std::shared_ptr<const Token> loadModule(const std::string &fileName);
+
+    // Like trying to open folder/fileName, but remembers folder contents
+    bool moduleFileExists(
+        const std::string &folder, const std::string &fileName
+    );
+
+    void clearModuleCache(void);
+}
@@ -0,0 +1,52 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Interface for using the compiler as a library (libnabd)
+ *  - Nothing here exits the process. Failures come back as diagnostics
+ *  - Safe to call from several threads at once, as long as two calls aren't
+ *    building the same module
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <FileIo.hpp>
+
+namespace nabd {
+    struct Diagnostic {
+        std::string fileName;
+        uint64_t line, col; // 0 if it isn't about a particular spot
+        std::string message;
+    };
+
+    enum class CompileStatus {
+        Success, ParseError, CodeGenError, BuildError
+    };
+
+    struct CompileResult {
+        bool success(void) const {
+            return status == CompileStatus::Success;
+        }
+
+        CompileStatus status;
+        std::vector<Diagnostic> diagnostics;
+        std::string cppCode; // Generated code (C with cBackend), if any
+        std::string log; // Everything the compiler and tools it ran printed
+    };
+
+    /*
+     * Parse & generate C++ for code that doesn't need to be in a file.
+     * inputs.fileName names the module (for its build folder & diagnostics)
+     */
+    CompileResult compileSource(
+        const std::string &code, const InputArguments &inputs
+    );
+
+    // Everything `nabc <module>` does: parse, generate C++, build the object
+    CompileResult compileModule(const InputArguments &inputs);
+
+    // Everything `nabc <program> -k <objects>` does
+    CompileResult linkProgram(const InputArguments &inputs);
+}
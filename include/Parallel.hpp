@@ -0,0 +1,27 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Runs independent pieces of work (like generating function bodies)
+ *    across a few threads
+ *  - Tasks write their results into their own slot, so callers get the same
+ *    output no matter how the work was split up
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace nabd {
+    /*
+     * Calls task(0) ... task(count - 1), each exactly once, and returns when
+     * they're all done. Only spreads out over threads when there are at
+     * least minPerThread tasks for each one. If a task throws, the first
+     * exception is rethrown here once the others have stopped.
+     * Tasks run with the default log stream, so they shouldn't log
+     */
+    void parallelFor(
+        const size_t count, const std::function<void(size_t)> &task,
+        const size_t minPerThread = 1
+    );
+}
@@ -0,0 +1,32 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - nabd has no statements, so programs run things in order by putting
+ *    them in a list or tuple whose value is thrown away, like
+ *    snd({ [ print(a), print(b) ], 0d0# })
+ *  - This finds the values that are thrown away and turns the lists and
+ *    tuples making them into a plain sequence (a chain of Lets), so the
+ *    calls still run in order but no container is built
+ */
+
+#pragma once
+
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+
+namespace nabd {
+    namespace sequencing {
+        /*
+         * A copy of program where the first item of snd({ a, b }), the
+         * second of fst({ a, b }) and anything inside those are worked out
+         * only for what they do. Pure parts are dropped and impure ones
+         * run in the order they're written.
+         * In the module with main, a function whose result every caller
+         * throws away (or returns from such a function) is treated the
+         * same way, so lists it returns are never built
+         */
+        Token lowerDiscarded(
+            const Token &program, const types::TypeContext &ctx
+        );
+    }
+}
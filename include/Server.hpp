@@ -0,0 +1,27 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Long running ways to use the compiler that keep their caches warm
+ *  - A compile server that takes requests from nabc over a Unix socket
+ *  - A watch mode that rebuilds affected modules whenever files change
+ */
+
+#pragma once
+
+#include <string>
+#include <FileIo.hpp>
+
+namespace nabd {
+    // $NABC_SERVER if set, otherwise a per-user socket in a temp folder
+    std::string defaultSocketPath(void);
+
+    void runServer(const std::string &socketPath, const std::string &nabcPath);
+
+    // Forwards the invocation to a server. False if none could be reached
+    bool runClient(
+        const std::string &socketPath, const int argc, const char **args,
+        int &exitCode
+    );
+
+    void runWatch(const InputArguments &inputs, const std::string &nabcPath);
+}
@@ -0,0 +1,92 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Finds the functions of a module that call themselves or each other
+ *    as the last thing they do (in tail position)
+ *  - Codegen turns each such group into one function that loops rather
+ *    than calling, so looping by recursion runs in constant stack
+ *  - A call wrapped in inc/dec (linear recursion like inc(f(dec(n))))
+ *    counts too. The loop counts how many times the steps are left to do
+ *    and does them on the result at the end (an accumulator)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+
+namespace nabd {
+    namespace tailcalls {
+        // A function as it's generated, either generic or its number clone
+        struct TailMember {
+            const Token *funcDef;
+            bool isClone;
+
+            // f or f__num
+            std::string name;
+        };
+
+        /*
+         * Functions that tail call each other (or one that tail calls
+         * itself). Their code goes in one function, named after the first
+         * member, with a case for each of them
+         */
+        struct TailGroup {
+            std::string name;
+            std::vector<TailMember> members;
+
+            // The inc/dec calls around its counted calls, outermost first
+            std::vector<std::string> steps;
+        };
+
+        struct TailGroups {
+            std::vector<TailGroup> groups;
+
+            // Member name to its group and case
+            std::map<std::string, std::pair<size_t, size_t>> byName;
+        };
+
+        // Functions in types.memoized are left out, as they keep calling
+        TailGroups findTailGroups(
+            const Token &program, const types::TypeContext &types
+        );
+
+        /*
+         * The user calls expr makes last (the FuncCall tokens), which a
+         * group could turn into a loop
+         */
+        std::set<const Token *> tailCallsIn(
+            const Token &expr, const types::TypeContext &types
+        );
+
+        // The function a call goes to (f or f__num), if it's a user one
+        std::string calleeName(
+            const Token &funcCall, const types::TypeContext &types
+        );
+
+        /*
+         * Groups of nodes that can all reach each other, found callees
+         * first. edges[i] holds the nodes i calls
+         */
+        std::vector<std::vector<size_t>> stronglyConnected(
+            const std::vector<std::vector<size_t>> &edges
+        );
+
+        // The loop function for a group whose first member is funcName
+        std::string groupFuncName(const std::string &funcName);
+
+        /*
+         * If funcCall is a chain of std inc/dec calls around a call, the
+         * innermost call (and the chain's callees, outermost first)
+         */
+        const Token *stepsAround(
+            const Token &funcCall, const types::TypeContext &types,
+            std::vector<std::string> &steps
+        );
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Wall clock time spent in each phase of a build (parse, codegen, the
+ *    child g++ and the link)
+ *  - Written out as a line of JSON per nabc run when asked to with
+ *    --timings <file> or NABC_TIMINGS, for the build benchmarks
+ */
+
+#pragma once
+
+#include <string>
+#include <chrono>
+
+namespace nabd {
+    struct PhaseTimings {
+        double parseMs = 0, codeGenMs = 0, cxxMs = 0, linkMs = 0;
+    };
+
+    // Per thread, so the compile server's requests don't mix
+    PhaseTimings &phaseTimings(void);
+
+    // Adds the time until it goes out of scope onto one of the phases
+    struct PhaseTimer {
+        PhaseTimer(double &phaseMs);
+        ~PhaseTimer(void);
+
+        double &total;
+        const std::chrono::steady_clock::time_point start;
+    };
+
+    // Appends {"module":..., "mode":..., "parse_ms":..., ...} to fileName
+    void appendTimings(
+        const std::string &fileName,
+        const std::string &moduleName, const std::string &mode,
+        const PhaseTimings &timings, const double totalMs
+    );
+}
@@ -9,9 +9,13 @@
 #include <vector>
 
 namespace nabd {
+    /*
+     * Let isn't written in nabd. The inliner makes it to bind a value to a
+     * temporary: [name, value, body]
+     */
     enum class TokenType {
         Program, Include, FuncDef,
-        FuncCall, Ternary, ListDef, TupDef, Expr,
+        FuncCall, Ternary, ListDef, TupDef, Let, Expr,
         DolSign, EquSign, Period, RArr, LPar, RPar, QMark, Colon, LBrak, RBrak,
         LCurl, RCurl, Comma, Exclam,
         Decimal, Hex, String, Identifier,
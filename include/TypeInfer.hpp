@@ -0,0 +1,101 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Works out which expressions have a type that's known when compiling
+ *  - Codegen uses it to keep numbers as plain doubles (see CodeGen.cpp)
+ *    rather than boxing every one in a NumberVariable, and to pass tuple
+ *    literals as their two halves rather than building a TupleVariable
+ */
+
+#pragma once
+
+#include <string>
+#include <set>
+#include <map>
+#include <memory>
+#include <Token.hpp>
+#include <FileIo.hpp>
+
+namespace nabd {
+    namespace types {
+        enum class ExprType { Unknown, Number, String, List, Tuple };
+
+        /*
+         * What a module's code can assume about the functions it calls.
+         * The sets are shared so each function clone's context is cheap
+         * to copy
+         */
+        struct TypeContext {
+            bool hasStd = false;
+
+            // Defined in the module or a nabd module it includes
+            std::shared_ptr<const std::set<std::string>> userFuncs =
+                std::make_shared<const std::set<std::string>>();
+
+            /*
+             * The module's functions that some call passes a known number,
+             * which get a clone taking a plain double (see CodeGen.cpp)
+             */
+            std::shared_ptr<const std::set<std::string>> numberClones =
+                std::make_shared<const std::set<std::string>>();
+
+            /*
+             * The module's functions whose parameter is only ever taken
+             * apart with fst and snd, and that some call passes a tuple
+             * literal. They get a clone taking the two halves instead
+             */
+            std::shared_ptr<const std::set<std::string>> tupleClones =
+                std::make_shared<const std::set<std::string>>();
+
+            // Pure recursive functions whose results are cached (--memoize)
+            std::shared_ptr<const std::set<std::string>> memoized =
+                std::make_shared<const std::set<std::string>>();
+
+            /*
+             * Literals (and lists and tuples of them) made once for the
+             * whole module, by the name they're kept in (see CodeGen.cpp)
+             */
+            std::shared_ptr<const std::map<std::string, std::string>>
+                constants =
+                    std::make_shared<
+                        const std::map<std::string, std::string>
+                    >();
+
+            // Inside a number clone, the parameter that's a plain double
+            std::string numberParam;
+
+            // Inside a tuple clone, the parameter given as its two halves
+            std::string tupleParam;
+        };
+        TypeContext moduleTypeContext(
+            const Token &program, const InputArguments &cliInputs
+        );
+
+        // f's clone is f__num, unless the module already has a function
+        std::string numberCloneName(const std::string &funcName);
+
+        // Whether a call can go straight to its callee's number clone
+        bool callsNumberClone(const Token &funcCall, const TypeContext &ctx);
+
+        // f's clone taking its parameter's halves is f__tup
+        std::string tupleCloneName(const std::string &funcName);
+
+        // fst(p) and snd(p) in a tuple clone are p__fst and p__snd
+        std::string tupleHalfName(
+            const std::string &param, const std::string &half
+        );
+
+        // Whether a call passes a tuple literal to its callee's tuple clone
+        bool callsTupleClone(const Token &funcCall, const TypeContext &ctx);
+
+        // Whether a call goes to std (if std has a function by that name)
+        bool isStdCall(const Token &funcCall, const TypeContext &ctx);
+
+        /*
+         * Parameters (but a number clone's) and user function results are
+         * Unknown. std calls, literals and ternaries whose arms agree are
+         * known
+         */
+        ExprType inferType(const Token &expr, const TypeContext &ctx);
+    }
+}
@@ -22,11 +22,69 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <stdexcept>
+#include <climits>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
 
 namespace nabd {
-    inline void errorOut(const std::string &errorMsg) {
-        std::cerr << "Error: " << errorMsg << std::endl;
-        exit(-1);
+    /*
+     * Thrown by errorOut. main reports it and exits, but long running
+     * processes (like the compile server) can catch it and keep going.
+     * Line and column are 0 when the error isn't about a spot in the code
+     */
+    struct CompileError : public std::runtime_error {
+        CompileError(
+                const std::string &errorMsg,
+                const uint64_t errLine = 0, const uint64_t errCol = 0) :
+                std::runtime_error(errorMsg), line(errLine), col(errCol) {
+        }
+
+        std::string fileName;
+        uint64_t line, col;
+    };
+
+    [[noreturn]] inline void errorOut(
+            const std::string &errorMsg,
+            const uint64_t line = 0, const uint64_t col = 0) {
+        throw CompileError(errorMsg, line, col);
+    }
+
+    /*
+     * Where progress messages go. It's per thread so that builds running
+     * side by side (see Nabd.hpp) can each capture their own
+     */
+    inline std::ostream *&logStream(void) {
+        thread_local std::ostream *stream = &std::cout;
+        return stream;
+    }
+
+    inline std::ostream &logOut(void) {
+        return *logStream();
+    }
+
+    // Run a shell command with its output going to the log. False on failure
+    inline bool runCommand(const std::string &cmd) {
+        logOut() << cmd << std::endl;
+#if defined(_WIN32) || defined(WIN32)
+        auto pipe = _popen((cmd + " 2>&1").c_str(), "r");
+#else
+        auto pipe = popen((cmd + " 2>&1").c_str(), "r");
+#endif
+        if(pipe == NULL) {
+            return false;
+        }
+        char buff[512];
+        while(fgets(buff, sizeof(buff), pipe) != NULL) {
+            logOut() << buff;
+        }
+        logOut().flush();
+#if defined(_WIN32) || defined(WIN32)
+        return _pclose(pipe) == 0;
+#else
+        return pclose(pipe) == 0;
+#endif
     }
 
     inline void padStringStream(
@@ -47,6 +105,34 @@ namespace nabd {
         return sstr.str();
     }
 
+    // Leaves the file (and its timestamp) alone if it already holds contents
+    inline bool writeFileIfChanged(
+            const std::string &fileName, const std::string &contents,
+            bool *changed = nullptr) {
+        if(changed) {
+            *changed = false;
+        }
+        std::ifstream oldFile(fileName);
+        if(oldFile.is_open()) {
+            std::ostringstream sstr;
+            sstr << oldFile.rdbuf();
+            oldFile.close();
+            if(sstr.str() == contents) {
+                return true;
+            }
+        }
+        std::ofstream newFile(fileName);
+        if(!newFile.is_open()) {
+            return false;
+        }
+        newFile << contents;
+        newFile.close();
+        if(changed) {
+            *changed = true;
+        }
+        return true;
+    }
+
     inline bool isWhiteSpace(const char c) {
         return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
     }
@@ -104,4 +190,42 @@ namespace nabd {
 #endif
         return std::string(buff);
     }
+
+    // Falls back to the name as given if the file doesn't exist (yet)
+    inline std::string getFullPath(const std::string &name) {
+#if defined(_WIN32) || defined(WIN32)
+        char buff[_MAX_PATH];
+        if(_fullpath(buff, name.c_str(), _MAX_PATH) == NULL) {
+            return name;
+        }
+#else
+        char buff[PATH_MAX];
+        if(realpath((name != "" ? name : ".").c_str(), buff) == NULL) {
+            return name;
+        }
+#endif
+        return std::string(buff);
+    }
+
+    // Folder holding the running executable, or "" if it can't be found
+    inline std::string getExecutableDir(void) {
+#if defined(_WIN32) || defined(WIN32)
+        char buff[_MAX_PATH];
+        const auto len = GetModuleFileNameA(NULL, buff, _MAX_PATH);
+        if(len == 0 || len == _MAX_PATH) {
+            return "";
+        }
+        const auto path = std::string(buff, len);
+        const auto slash = path.find_last_of("\\/");
+#else
+        char buff[PATH_MAX];
+        const auto len = readlink("/proc/self/exe", buff, PATH_MAX);
+        if(len <= 0 || len == PATH_MAX) {
+            return "";
+        }
+        const auto path = std::string(buff, len);
+        const auto slash = path.find_last_of('/');
+#endif
+        return slash != std::string::npos ? path.substr(0, slash) : "";
+    }
 }
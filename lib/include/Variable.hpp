@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 #include <memory>
+#include <list>
+#include <unordered_map>
 
 // Interface for all variables to be convertable to eachother
 enum class VariableType {
@@ -63,6 +65,14 @@ struct NumberVariable : public Variable {
     const double value;
 };
 
+// A variable's value as a number, without allocating if it already is one
+inline double numberValue(const VariablePointer &var) {
+    const auto num = dynamic_cast<const NumberVariable *>(var.get());
+    return num != nullptr ?
+        num->value :
+        std::dynamic_pointer_cast<NumberVariable>(var->toNumber())->value;
+}
+
 struct ListVariable : public Variable {
     ListVariable(const std::vector<VariablePointer> &data);
     
@@ -73,7 +83,8 @@ struct ListVariable : public Variable {
     ) const override;
     VariablePointer toTuple(void) const override;
     
-    const std::vector<VariablePointer> values;
+    // Only written by generated code filling in a result (see CodeGen.cpp)
+    std::vector<VariablePointer> values;
 };
 
 struct TupleVariable : public Variable {
@@ -88,5 +99,41 @@ struct TupleVariable : public Variable {
     ) const override;
     VariablePointer toTuple(void) const override;
     
-    const std::pair<VariablePointer, VariablePointer> values;
+    // Only written by generated code filling in a result (see CodeGen.cpp)
+    std::pair<VariablePointer, VariablePointer> values;
+};
+
+// Structural hash and equality of values, as used for memoizing
+size_t variableHash(const VariablePointer &var);
+bool variablesEqual(const VariablePointer &left, const VariablePointer &right);
+
+/*
+ * Results of a pure function by argument value (see --memoize). Once full,
+ * the least recently used result makes room. Hits and misses are reported
+ * on stderr when the program ends
+ */
+struct MemoTable {
+    MemoTable(const char *funcName, const size_t capacity);
+    ~MemoTable(void);
+
+    bool find(const VariablePointer &arg, VariablePointer &result);
+    void insert(const VariablePointer &arg, const VariablePointer &result);
+
+    struct KeyHash {
+        size_t operator()(const VariablePointer &var) const;
+    };
+    struct KeyEqual {
+        bool operator()(
+            const VariablePointer &left, const VariablePointer &right
+        ) const;
+    };
+    typedef std::list<std::pair<VariablePointer, VariablePointer>> Entries;
+
+    const char *funcName;
+    const size_t capacity;
+    Entries entries; // Most recently used first
+    std::unordered_map<
+        VariablePointer, Entries::iterator, KeyHash, KeyEqual
+    > byArg;
+    size_t hits, misses, evictions;
 };
@@ -10,6 +10,10 @@
 #include <sstream>
 #include <vector>
 #include <memory>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <cstdio>
 #include <Variable.hpp>
 
 // All of them use a similar toList, so this is code reuse
@@ -149,10 +153,12 @@ ListVariable::ListVariable(
 VariablePointer ListVariable::toString(void) const {
     std::stringstream listStr;
     listStr << "{ ";
-    for(const auto value : values) {
+    for(size_t i = 0; i < values.size(); i++) {
         listStr <<
-            std::dynamic_pointer_cast<StringVariable>(value->toString())->value;
-        if(value != *(values.end() - 1)) {
+            std::dynamic_pointer_cast<StringVariable>(
+                values[i]->toString()
+            )->value;
+        if(i + 1 < values.size()) {
             listStr << ", ";
         }
     }
@@ -177,3 +183,111 @@ VariablePointer ListVariable::toTuple(void) const {
         std::make_shared<ListVariable>(values)
     ));
 }
+
+size_t variableHash(const VariablePointer &var) {
+    const auto combine = [](const size_t seed, const size_t hash) {
+        return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    const auto str = dynamic_cast<const StringVariable *>(var.get());
+    const auto num = dynamic_cast<const NumberVariable *>(var.get());
+    const auto tup = dynamic_cast<const TupleVariable *>(var.get());
+    const auto list = dynamic_cast<const ListVariable *>(var.get());
+    if(str != nullptr) {
+        return combine(1, std::hash<std::string>()(str->value));
+    } else if(num != nullptr) {
+        // -0 equals 0, so it has to hash the same
+        return combine(2, std::hash<double>()(num->value + 0.0));
+    } else if(tup != nullptr) {
+        return combine(
+            combine(3, variableHash(tup->values.first)),
+            variableHash(tup->values.second)
+        );
+    }
+    size_t hash = 4;
+    for(const auto &item : list->values) {
+        hash = combine(hash, variableHash(item));
+    }
+    return hash;
+}
+
+// Values of different types are never equal, even if they'd convert
+bool variablesEqual(const VariablePointer &left, const VariablePointer &right) {
+    if(left == right) {
+        return true;
+    }
+    const auto str = dynamic_cast<const StringVariable *>(left.get());
+    const auto num = dynamic_cast<const NumberVariable *>(left.get());
+    const auto tup = dynamic_cast<const TupleVariable *>(left.get());
+    const auto list = dynamic_cast<const ListVariable *>(left.get());
+    if(str != nullptr) {
+        const auto other = dynamic_cast<const StringVariable *>(right.get());
+        return other != nullptr && other->value == str->value;
+    } else if(num != nullptr) {
+        const auto other = dynamic_cast<const NumberVariable *>(right.get());
+        return other != nullptr && other->value == num->value;
+    } else if(tup != nullptr) {
+        const auto other = dynamic_cast<const TupleVariable *>(right.get());
+        return other != nullptr
+            && variablesEqual(tup->values.first, other->values.first)
+            && variablesEqual(tup->values.second, other->values.second);
+    }
+    const auto other = dynamic_cast<const ListVariable *>(right.get());
+    if(other == nullptr || other->values.size() != list->values.size()) {
+        return false;
+    }
+    for(size_t i = 0; i < list->values.size(); i++) {
+        if(!variablesEqual(list->values[i], other->values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t MemoTable::KeyHash::operator()(const VariablePointer &var) const {
+    return variableHash(var);
+}
+
+bool MemoTable::KeyEqual::operator()(
+        const VariablePointer &left, const VariablePointer &right) const {
+    return variablesEqual(left, right);
+}
+
+MemoTable::MemoTable(const char *name, const size_t maxEntries) :
+        funcName(name), capacity(maxEntries), hits(0), misses(0),
+        evictions(0) {
+}
+
+MemoTable::~MemoTable(void) {
+    if(hits + misses > 0) {
+        std::fprintf(
+            stderr, "Memoized '%s': %zu hits, %zu misses, %zu evicted\n",
+            funcName, hits, misses, evictions
+        );
+    }
+}
+
+bool MemoTable::find(const VariablePointer &arg, VariablePointer &result) {
+    const auto entry = byArg.find(arg);
+    if(entry == byArg.end()) {
+        misses++;
+        return false;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, entry->second);
+    result = entry->second->second;
+    return true;
+}
+
+void MemoTable::insert(
+        const VariablePointer &arg, const VariablePointer &result) {
+    if(capacity == 0 || byArg.count(arg) > 0) {
+        return;
+    }
+    if(entries.size() >= capacity) {
+        byArg.erase(entries.back().first);
+        entries.pop_back();
+        evictions++;
+    }
+    entries.push_front({ arg, result });
+    byArg[arg] = entries.begin();
+}
@@ -0,0 +1,231 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the standard library (built into libnabdstd.a)
+ */
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <cstdlib>
+#include <Variable.hpp>
+#include <std.hpp>
+
+VariablePointer print(const VariablePointer &msg) {
+    std::cout <<
+        std::dynamic_pointer_cast<StringVariable>(msg->toString())->value;
+    return msg->toString();
+}
+
+VariablePointer input(const VariablePointer &dummy) {
+    std::string str;
+    std::getline(std::cin, str);
+    return std::make_shared<StringVariable>(str);
+}
+
+VariablePointer parseNum(const VariablePointer &str) {
+    const auto strData = std::dynamic_pointer_cast<StringVariable>(
+        str
+    )->value;
+    char *end;
+    const auto num = std::strtod(strData.c_str(), &end);
+    return std::make_shared<NumberVariable>(num);
+}
+
+VariablePointer len(const VariablePointer &ls) {
+    const auto strData = std::dynamic_pointer_cast<ListVariable>(
+        ls->toList(std::vector<VariableType>({ VariableType::Tuple }))
+    );
+    return std::make_shared<NumberVariable>(strData->values.size());
+}
+
+VariablePointer gt(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 > num2 ? 1 : -1);
+}
+
+VariablePointer lt(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 < num2 ? 1 : -1);
+}
+
+VariablePointer eq(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 == num2 ? 1 : -1);
+}
+
+VariablePointer gte(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 >= num2 ? 1 : -1);
+}
+
+VariablePointer lte(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 <= num2 ? 1 : -1);
+}
+
+VariablePointer ne(const VariablePointer &tup) {
+    const auto items = std::dynamic_pointer_cast<TupleVariable>(
+        tup->toTuple()
+    )->values;
+    const auto num1 = std::dynamic_pointer_cast<NumberVariable>(
+        items.first->toNumber()
+    )->value;
+    const auto num2 = std::dynamic_pointer_cast<NumberVariable>(
+        items.second->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num1 != num2 ? 1 : -1);
+}
+
+VariablePointer swap(const VariablePointer &param) {
+    const auto paramItems = std::dynamic_pointer_cast<ListVariable>(
+        param
+    )->values;
+    
+    if(paramItems.size() < 2) {
+        return param;
+    }
+    if(paramItems.size() < 3) {
+        return paramItems[1];
+    }
+
+    const auto ind = std::dynamic_pointer_cast<NumberVariable>(
+        paramItems[0]->toNumber()
+    )->value;
+    const auto baseList = std::dynamic_pointer_cast<ListVariable>(
+        paramItems[1]->toList({ VariableType::Tuple })
+    )->values;
+
+    if(ind >= baseList.size()) {
+        return paramItems[1];
+    } else {
+        std::vector<VariablePointer> newData;
+        for(size_t i = 0; i < baseList.size(); i++) {
+            if(i == static_cast<size_t>(std::floor(ind))) {
+                newData.push_back(paramItems[2]);
+                continue;
+            }
+
+            newData.push_back(baseList[i]);
+        }
+        return std::make_shared<ListVariable>(newData);
+    }
+}
+
+VariablePointer seedRandom(const VariablePointer &dummy) {
+    std::srand(std::time(NULL));
+    return std::make_shared<NumberVariable>(0);
+}
+
+VariablePointer random(const VariablePointer &btwn) {
+    const auto rangeVar = std::dynamic_pointer_cast<TupleVariable>(
+        btwn->toTuple()
+    )->values;
+    const auto min = std::dynamic_pointer_cast<NumberVariable>(
+        rangeVar.first->toNumber()
+    )->value;
+    const auto max = std::dynamic_pointer_cast<NumberVariable>(
+        rangeVar.second->toNumber()
+    )->value;
+
+    const auto range = max - min;
+    const auto div = static_cast<double>(RAND_MAX) / range;
+    const auto num = min + (static_cast<double>(rand()) / div);
+
+    return std::make_shared<NumberVariable>(num);
+}
+
+VariablePointer round(const VariablePointer &num) {
+    const auto value = std::dynamic_pointer_cast<NumberVariable>(
+        num->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(std::round(value));
+}
+
+VariablePointer floor(const VariablePointer &num) {
+    const auto value = std::dynamic_pointer_cast<NumberVariable>(
+        num->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(std::floor(value));
+}
+
+VariablePointer ceil(const VariablePointer &num) {
+    const auto value = std::dynamic_pointer_cast<NumberVariable>(
+        num->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(std::ceil(value));
+}
+
+VariablePointer elem(const VariablePointer &param) {
+    const auto pair = std::dynamic_pointer_cast<TupleVariable>(
+        param->toTuple()
+    )->values;
+    const auto list = std::dynamic_pointer_cast<ListVariable>(
+        pair.second->toList(std::vector<VariableType>({ VariableType::Tuple }))
+    )->values;
+    const auto ind = std::dynamic_pointer_cast<NumberVariable>(
+        pair.first->toNumber()
+    )->value;
+
+    if(ind >= list.size()) {
+        return param;
+    }
+
+    return list[ind];
+}
+
+VariablePointer inc(const VariablePointer &numVar) {
+    const auto num = std::dynamic_pointer_cast<NumberVariable>(
+        numVar->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num + 1);
+}
+
+VariablePointer dec(const VariablePointer &numVar) {
+    const auto num = std::dynamic_pointer_cast<NumberVariable>(
+        numVar->toNumber()
+    )->value;
+    return std::make_shared<NumberVariable>(num - 1);
+}
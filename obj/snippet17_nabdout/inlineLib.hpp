@@ -0,0 +1,5 @@
+#pragma once
+#include <Variable.hpp>
+// Inline interface hash: 1f03ac7cbb461d31
+VariablePointer shout(const VariablePointer &s);
+
@@ -0,0 +1,26 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer fake_main(const VariablePointer &args);
+static const VariablePointer lit0 = std::make_shared<StringVariable>("x");
+static const VariablePointer lit1 = std::make_shared<StringVariable>("y");
+VariablePointer fake_main(const VariablePointer &args) {
+    return print(std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(lit0), std::dynamic_pointer_cast<Variable>(lit1), std::dynamic_pointer_cast<Variable>(lit0), std::dynamic_pointer_cast<Variable>(len(args)),  })));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
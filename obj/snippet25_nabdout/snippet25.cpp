@@ -0,0 +1,32 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer twice(const VariablePointer &s);
+VariablePointer fake_main(const VariablePointer &args);
+static const VariablePointer lit0 = std::make_shared<NumberVariable>(0);
+VariablePointer twice(const VariablePointer &s) {
+    return [&]() -> VariablePointer {
+    [[maybe_unused]] const VariablePointer c0 = fst(s);
+    return print(std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(c0), std::dynamic_pointer_cast<Variable>(c0),  })));
+}();
+}
+VariablePointer fake_main(const VariablePointer &args) {
+    return twice(input(lit0));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <string>
+#include <utility>
+#include <vector>
+#include <memory>
+#include <list>
+#include <unordered_map>
+enum class VariableType { String, Number, List, Tuple };
+struct Variable {
+    virtual std::shared_ptr<Variable> toString(void) const = 0;
+    virtual std::shared_ptr<Variable> toNumber(void) const = 0;
+    virtual std::shared_ptr<Variable> toList(
+        const std::vector<VariableType> &subTypes
+    ) const = 0;
+    virtual std::shared_ptr<Variable> toTuple(void) const = 0;
+};
+typedef std::shared_ptr<Variable> VariablePointer;
+struct StringVariable : public Variable {
+    StringVariable(const std::string &data);
+    VariablePointer toString(void) const override;
+    VariablePointer toNumber(void) const override;
+    VariablePointer toList(
+        const std::vector<VariableType> &subTypes
+    ) const override;
+    VariablePointer toTuple(void) const override;
+    const std::string value;
+};
+struct NumberVariable : public Variable {
+    NumberVariable(const double data);
+    VariablePointer toString(void) const override;
+    VariablePointer toNumber(void) const override;
+    VariablePointer toList(
+        const std::vector<VariableType> &subTypes
+    ) const override;
+    VariablePointer toTuple(void) const override;
+    const double value;
+};
+inline double numberValue(const VariablePointer &var) {
+    const auto num = dynamic_cast<const NumberVariable *>(var.get());
+    return num != nullptr ?
+        num->value :
+        std::dynamic_pointer_cast<NumberVariable>(
+            var->toNumber()
+        )->value;
+}
+struct ListVariable : public Variable {
+    ListVariable(const std::vector<VariablePointer> &data);
+    VariablePointer toString(void) const override;
+    VariablePointer toNumber(void) const override;
+    VariablePointer toList(
+        const std::vector<VariableType> &subTypes
+    ) const override;
+    VariablePointer toTuple(void) const override;
+    std::vector<VariablePointer> values;
+};
+struct TupleVariable : public Variable {
+    TupleVariable(
+        const std::pair<VariablePointer, VariablePointer> &data
+    );
+    VariablePointer toString(void) const override;
+    VariablePointer toNumber(void) const override;
+    VariablePointer toList(
+        const std::vector<VariableType> &subTypes
+    ) const override;
+    VariablePointer toTuple(void) const override;
+    std::pair<VariablePointer, VariablePointer> values;
+};
+size_t variableHash(const VariablePointer &var);
+bool variablesEqual(
+    const VariablePointer &left, const VariablePointer &right
+);
+struct MemoTable {
+    MemoTable(const char *funcName, const size_t capacity);
+    ~MemoTable(void);
+    bool find(const VariablePointer &arg, VariablePointer &result);
+    void insert(
+        const VariablePointer &arg, const VariablePointer &result
+    );
+    struct KeyHash {
+        size_t operator()(const VariablePointer &var) const;
+    };
+    struct KeyEqual {
+        bool operator()(
+            const VariablePointer &left, const VariablePointer &right
+        ) const;
+    };
+    typedef std::list<std::pair<VariablePointer, VariablePointer>>
+        Entries;
+    const char *funcName;
+    const size_t capacity;
+    Entries entries;
+    std::unordered_map<
+        VariablePointer, Entries::iterator, KeyHash, KeyEqual
+    > byArg;
+    size_t hits, misses, evictions;
+};
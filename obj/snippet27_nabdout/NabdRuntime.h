@@ -0,0 +1,34 @@
+#ifndef NABD_RUNTIME_H
+#define NABD_RUNTIME_H
+#include <stddef.h>
+typedef enum {
+    NABD_STRING, NABD_NUMBER, NABD_LIST, NABD_TUPLE
+} NabdType;
+typedef struct NabdVar NabdVar;
+struct NabdVar {
+    NabdType type;
+    size_t refs;
+    union {
+        struct { char *data; size_t len; } str;
+        double num;
+        struct { NabdVar **items; size_t len; } list;
+        struct { NabdVar *first, *second; } tup;
+    } as;
+};
+NabdVar *nabd_string(const char *data, size_t len);
+NabdVar *nabd_cstring(const char *data);
+NabdVar *nabd_number(double value);
+NabdVar *nabd_list(size_t len);
+NabdVar *nabd_list_of(int count, ...);
+NabdVar *nabd_tuple(NabdVar *first, NabdVar *second);
+NabdVar *nabd_ref(NabdVar *var);
+void nabd_unref(NabdVar *var);
+NabdVar *nabd_to_string(NabdVar *var);
+NabdVar *nabd_to_number(NabdVar *var);
+NabdVar *nabd_to_list(
+    NabdVar *var, const NabdType *subTypes, size_t count
+);
+NabdVar *nabd_to_tuple(NabdVar *var);
+double nabd_num(NabdVar *var);
+int nabd_truthy(NabdVar *var);
+#endif
@@ -0,0 +1,143 @@
+#ifndef NABD_STD_H
+#define NABD_STD_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "NabdRuntime.h"
+static const NabdType nabd_std_tuple[] = { NABD_TUPLE };
+static inline NabdVar *nabd_fn_print(NabdVar *msg) {
+    NabdVar *str = nabd_to_string(msg);
+    fwrite(str->as.str.data, 1, str->as.str.len, stdout);
+    return str;
+}
+static inline NabdVar *nabd_fn_input(NabdVar *dummy) {
+    NabdVar *str;
+    char *data = NULL;
+    size_t len = 0, cap = 0;
+    int c;
+    (void) dummy;
+    fflush(stdout);
+    while((c = getchar()) != EOF && c != '\n') {
+        if(len + 1 > cap) {
+            cap = cap > 0 ? cap * 2 : 64;
+            data = (char *) realloc(data, cap);
+        }
+        data[len++] = (char) c;
+    }
+    str = nabd_string(data != NULL ? data : "", len);
+    free(data);
+    return str;
+}
+static inline NabdVar *nabd_fn_parseNum(NabdVar *str) {
+    NabdVar *strVar = nabd_to_string(str);
+    const double num = strtod(strVar->as.str.data, NULL);
+    nabd_unref(strVar);
+    return nabd_number(num);
+}
+static inline NabdVar *nabd_fn_len(NabdVar *ls) {
+    NabdVar *list = nabd_to_list(ls, nabd_std_tuple, 1);
+    const double len = (double) list->as.list.len;
+    nabd_unref(list);
+    return nabd_number(len);
+}
+#define NABD_STD_COMPARE(name, op) \
+    static inline NabdVar *nabd_fn_##name(NabdVar *tup) { \
+        NabdVar *items = nabd_to_tuple(tup); \
+        const double num1 = nabd_num(items->as.tup.first); \
+        const double num2 = nabd_num(items->as.tup.second); \
+        nabd_unref(items); \
+        return nabd_number(num1 op num2 ? 1 : -1); \
+    }
+NABD_STD_COMPARE(gt, >)
+NABD_STD_COMPARE(lt, <)
+NABD_STD_COMPARE(eq, ==)
+NABD_STD_COMPARE(gte, >=)
+NABD_STD_COMPARE(lte, <=)
+NABD_STD_COMPARE(ne, !=)
+#undef NABD_STD_COMPARE
+static inline NabdVar *nabd_fn_swap(NabdVar *param) {
+    NabdVar *baseList, *newList;
+    double ind;
+    size_t i;
+    if(param->type != NABD_LIST || param->as.list.len < 2) {
+        return nabd_ref(param);
+    }
+    if(param->as.list.len < 3) {
+        return nabd_ref(param->as.list.items[1]);
+    }
+    ind = nabd_num(param->as.list.items[0]);
+    baseList =
+        nabd_to_list(param->as.list.items[1], nabd_std_tuple, 1);
+    if(ind >= (double) baseList->as.list.len) {
+        nabd_unref(baseList);
+        return nabd_ref(param->as.list.items[1]);
+    }
+    newList = nabd_list(baseList->as.list.len);
+    for(i = 0; i < baseList->as.list.len; i++) {
+        newList->as.list.items[i] = nabd_ref(
+            ind >= 0 && i == (size_t) floor(ind) ?
+                param->as.list.items[2] :
+                baseList->as.list.items[i]
+        );
+    }
+    nabd_unref(baseList);
+    return newList;
+}
+static inline NabdVar *nabd_fn_seedRandom(NabdVar *dummy) {
+    (void) dummy;
+    srand((unsigned) time(NULL));
+    return nabd_number(0);
+}
+static inline NabdVar *nabd_fn_random(NabdVar *btwn) {
+    NabdVar *range = nabd_to_tuple(btwn);
+    const double min = nabd_num(range->as.tup.first);
+    const double max = nabd_num(range->as.tup.second);
+    const double div = (double) RAND_MAX / (max - min);
+    nabd_unref(range);
+    return nabd_number(min + ((double) rand() / div));
+}
+static inline NabdVar *nabd_fn_round(NabdVar *num) {
+    return nabd_number(round(nabd_num(num)));
+}
+static inline NabdVar *nabd_fn_floor(NabdVar *num) {
+    return nabd_number(floor(nabd_num(num)));
+}
+static inline NabdVar *nabd_fn_ceil(NabdVar *num) {
+    return nabd_number(ceil(nabd_num(num)));
+}
+static inline NabdVar *nabd_fn_elem(NabdVar *param) {
+    NabdVar *pair = nabd_to_tuple(param), *list, *item;
+    const double ind = nabd_num(pair->as.tup.first);
+    list = nabd_to_list(pair->as.tup.second, nabd_std_tuple, 1);
+    nabd_unref(pair);
+    if(ind < 0 || ind >= (double) list->as.list.len) {
+        nabd_unref(list);
+        return nabd_ref(param);
+    }
+    item = nabd_ref(list->as.list.items[(size_t) ind]);
+    nabd_unref(list);
+    return item;
+}
+static inline NabdVar *nabd_fn_inc(NabdVar *num) {
+    return nabd_number(nabd_num(num) + 1);
+}
+static inline NabdVar *nabd_fn_dec(NabdVar *num) {
+    return nabd_number(nabd_num(num) - 1);
+}
+static inline NabdVar *nabd_fn_dup(NabdVar *var) {
+    return nabd_tuple(nabd_ref(var), nabd_ref(var));
+}
+static inline NabdVar *nabd_fn_fst(NabdVar *param) {
+    NabdVar *pair = nabd_to_tuple(param);
+    NabdVar *first = nabd_ref(pair->as.tup.first);
+    nabd_unref(pair);
+    return first;
+}
+static inline NabdVar *nabd_fn_snd(NabdVar *param) {
+    NabdVar *pair = nabd_to_tuple(param);
+    NabdVar *second = nabd_ref(pair->as.tup.second);
+    nabd_unref(pair);
+    return second;
+}
+#endif
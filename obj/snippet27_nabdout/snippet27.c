@@ -0,0 +1,32 @@
+#include <NabdRuntime.h>
+#include <NabdStd.h>
+NabdVar *nabd_fn_main(NabdVar *args);
+
+NabdVar *nabd_fn_main(NabdVar *args) {
+    NabdVar *t1 = nabd_cstring("x");
+    NabdVar *t3 = nabd_fn_len(args);
+    NabdVar *t4 = nabd_cstring("y");
+    NabdVar *t2 = nabd_list_of(2, t3, t4);
+    NabdVar *t6 = nabd_cstring("a");
+    NabdVar *t7 = nabd_list_of(0);
+    NabdVar *t5 = nabd_tuple(t6, t7);
+    NabdVar *t0 = nabd_list_of(3, t1, t2, t5);
+    NabdVar *t8 = nabd_fn_print(t0);
+    nabd_unref(t0);
+    return t8;
+}
+
+int main(int argc, char **args) {
+    NabdVar *argVars = nabd_list(argc > 1 ? argc - 1 : 0);
+    int i;
+    NabdVar *retVal;
+    int status;
+    for(i = 1; i < argc; i++) {
+        argVars->as.list.items[i - 1] = nabd_cstring(args[i]);
+    }
+    retVal = nabd_fn_main(argVars);
+    status = (int) nabd_num(retVal);
+    nabd_unref(retVal);
+    nabd_unref(argVars);
+    return status;
+}
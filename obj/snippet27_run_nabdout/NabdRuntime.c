@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "NabdRuntime.h"
+static NabdVar *nabd_alloc(NabdType type) {
+    NabdVar *var = (NabdVar *) malloc(sizeof(NabdVar));
+    if(var == NULL) {
+        fputs("Out of memory!\n", stderr);
+        exit(1);
+    }
+    var->type = type;
+    var->refs = 1;
+    return var;
+}
+NabdVar *nabd_string(const char *data, size_t len) {
+    NabdVar *var = nabd_alloc(NABD_STRING);
+    var->as.str.data = (char *) malloc(len + 1);
+    memcpy(var->as.str.data, data, len);
+    var->as.str.data[len] = '\0';
+    var->as.str.len = len;
+    return var;
+}
+NabdVar *nabd_cstring(const char *data) {
+    return nabd_string(data, strlen(data));
+}
+NabdVar *nabd_number(double value) {
+    NabdVar *var = nabd_alloc(NABD_NUMBER);
+    var->as.num = value;
+    return var;
+}
+NabdVar *nabd_list(size_t len) {
+    NabdVar *var = nabd_alloc(NABD_LIST);
+    var->as.list.items =
+        (NabdVar **) malloc((len > 0 ? len : 1) * sizeof(NabdVar *));
+    var->as.list.len = len;
+    return var;
+}
+NabdVar *nabd_list_of(int count, ...) {
+    NabdVar *var = nabd_list((size_t) count);
+    va_list items;
+    int i;
+    va_start(items, count);
+    for(i = 0; i < count; i++) {
+        var->as.list.items[i] = va_arg(items, NabdVar *);
+    }
+    va_end(items);
+    return var;
+}
+NabdVar *nabd_tuple(NabdVar *first, NabdVar *second) {
+    NabdVar *var = nabd_alloc(NABD_TUPLE);
+    var->as.tup.first = first;
+    var->as.tup.second = second;
+    return var;
+}
+NabdVar *nabd_ref(NabdVar *var) {
+    var->refs++;
+    return var;
+}
+void nabd_unref(NabdVar *var) {
+    size_t i;
+    if(--var->refs > 0) {
+        return;
+    }
+    switch(var->type) {
+        case NABD_STRING:
+            free(var->as.str.data);
+            break;
+        case NABD_LIST:
+            for(i = 0; i < var->as.list.len; i++) {
+                nabd_unref(var->as.list.items[i]);
+            }
+            free(var->as.list.items);
+            break;
+        case NABD_TUPLE:
+            nabd_unref(var->as.tup.first);
+            nabd_unref(var->as.tup.second);
+            break;
+        default:
+            break;
+    }
+    free(var);
+}
+typedef struct {
+    char *data;
+    size_t len, cap;
+} NabdBuffer;
+static void nabd_append(
+        NabdBuffer *buff, const char *data, size_t len) {
+    if(buff->len + len + 1 > buff->cap) {
+        buff->cap = (buff->len + len + 1) * 2;
+        buff->data = (char *) realloc(buff->data, buff->cap);
+    }
+    memcpy(buff->data + buff->len, data, len);
+    buff->len += len;
+}
+static void nabd_append_var(NabdBuffer *buff, NabdVar *var) {
+    NabdVar *str = nabd_to_string(var);
+    nabd_append(buff, str->as.str.data, str->as.str.len);
+    nabd_unref(str);
+}
+static NabdVar *nabd_take_buffer(NabdBuffer *buff) {
+    NabdVar *var =
+        nabd_string(buff->data != NULL ? buff->data : "", buff->len);
+    free(buff->data);
+    return var;
+}
+NabdVar *nabd_to_string(NabdVar *var) {
+    NabdBuffer buff = { NULL, 0, 0 };
+    char num[512];
+    size_t i;
+    switch(var->type) {
+        case NABD_STRING:
+            return nabd_ref(var);
+        case NABD_NUMBER:
+            snprintf(num, sizeof(num), "%f", var->as.num);
+            return nabd_cstring(num);
+        case NABD_TUPLE:
+            nabd_append(&buff, "(", 1);
+            nabd_append_var(&buff, var->as.tup.first);
+            nabd_append(&buff, ", ", 2);
+            nabd_append_var(&buff, var->as.tup.second);
+            nabd_append(&buff, ")", 1);
+            return nabd_take_buffer(&buff);
+        default:
+            nabd_append(&buff, "{", 1);
+            for(i = 0; i < var->as.list.len; i++) {
+                nabd_append_var(&buff, var->as.list.items[i]);
+                if(i > 0) {
+                    nabd_append(&buff, ", ", 2);
+                }
+            }
+            return nabd_take_buffer(&buff);
+    }
+}
+double nabd_num(NabdVar *var) {
+    switch(var->type) {
+        case NABD_STRING:
+            return var->as.str.len > 0 ?
+                (double) var->as.str.data[0] : 0;
+        case NABD_NUMBER:
+            return var->as.num;
+        case NABD_TUPLE:
+            return nabd_num(var->as.tup.first);
+        default:
+            return var->as.list.len > 0 ?
+                nabd_num(var->as.list.items[0]) : 0;
+    }
+}
+NabdVar *nabd_to_number(NabdVar *var) {
+    if(var->type == NABD_NUMBER) {
+        return nabd_ref(var);
+    }
+    return nabd_number(nabd_num(var));
+}
+int nabd_truthy(NabdVar *var) {
+    return nabd_num(var) > 0;
+}
+NabdVar *nabd_to_tuple(NabdVar *var) {
+    if(var->type == NABD_TUPLE) {
+        return nabd_ref(var);
+    }
+    return nabd_tuple(nabd_ref(var), nabd_ref(var));
+}
+NabdVar *nabd_to_list(
+        NabdVar *var, const NabdType *subTypes, size_t count) {
+    NabdType subSubTypes[16];
+    size_t i, subCount = 0;
+    NabdVar *list, *str;
+    if(var->type == NABD_LIST) {
+        return nabd_ref(var);
+    }
+    switch(count > 0 ? subTypes[0] : NABD_TUPLE) {
+        case NABD_LIST:
+            for(i = 0; i < count && subCount < 16; i++) {
+                if(subTypes[i] != subTypes[0]) {
+                    subSubTypes[subCount++] = subTypes[i];
+                }
+            }
+            return nabd_list_of(
+                1, nabd_to_list(var, subSubTypes, subCount)
+            );
+        case NABD_NUMBER:
+            return nabd_list_of(1, nabd_to_number(var));
+        case NABD_STRING:
+            str = nabd_to_string(var);
+            list = nabd_list(str->as.str.len);
+            for(i = 0; i < str->as.str.len; i++) {
+                list->as.list.items[i] =
+                    nabd_string(str->as.str.data + i, 1);
+            }
+            nabd_unref(str);
+            return list;
+        default:
+            return nabd_list_of(1, nabd_to_tuple(var));
+    }
+}
@@ -0,0 +1,29 @@
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer fake_main(const VariablePointer &args);
+static const VariablePointer lit0 = std::make_shared<StringVariable>("x");
+static const VariablePointer lit1 = std::make_shared<StringVariable>("y");
+static const VariablePointer lit2 = std::make_shared<StringVariable>("a");
+static const VariablePointer lit3 = std::make_shared<ListVariable>(std::vector<VariablePointer>({ }));
+static const VariablePointer lit4 = std::make_shared<TupleVariable>(std::pair<VariablePointer, VariablePointer>(lit2, lit3));
+VariablePointer fake_main(const VariablePointer &args) {
+    return print(std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(lit0), std::dynamic_pointer_cast<Variable>(std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(len(args)), std::dynamic_pointer_cast<Variable>(lit1),  }))), std::dynamic_pointer_cast<Variable>(lit4),  })));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <Variable.hpp>
+#include <std.hpp>
+VariablePointer f0(const VariablePointer &a);
+VariablePointer f1(const VariablePointer &a);
+VariablePointer f2(const VariablePointer &a);
+VariablePointer f3(const VariablePointer &a);
+VariablePointer f4(const VariablePointer &a);
+VariablePointer f5(const VariablePointer &a);
+VariablePointer f6(const VariablePointer &a);
+VariablePointer f7(const VariablePointer &a);
+VariablePointer f8(const VariablePointer &a);
+VariablePointer f9(const VariablePointer &a);
+VariablePointer f10(const VariablePointer &a);
+VariablePointer f11(const VariablePointer &a);
+VariablePointer f12(const VariablePointer &a);
+VariablePointer f13(const VariablePointer &a);
+VariablePointer f14(const VariablePointer &a);
+VariablePointer f15(const VariablePointer &a);
+VariablePointer f16(const VariablePointer &a);
+VariablePointer f17(const VariablePointer &a);
+VariablePointer f18(const VariablePointer &a);
+VariablePointer f19(const VariablePointer &a);
+VariablePointer f20(const VariablePointer &a);
+VariablePointer f21(const VariablePointer &a);
+VariablePointer f22(const VariablePointer &a);
+VariablePointer f23(const VariablePointer &a);
+VariablePointer f24(const VariablePointer &a);
+VariablePointer f25(const VariablePointer &a);
+VariablePointer f26(const VariablePointer &a);
+VariablePointer f27(const VariablePointer &a);
+VariablePointer f28(const VariablePointer &a);
+VariablePointer f29(const VariablePointer &a);
+VariablePointer f30(const VariablePointer &a);
+VariablePointer f31(const VariablePointer &a);
+VariablePointer f32(const VariablePointer &a);
+VariablePointer f33(const VariablePointer &a);
+VariablePointer f34(const VariablePointer &a);
+VariablePointer f35(const VariablePointer &a);
+VariablePointer f36(const VariablePointer &a);
+VariablePointer f37(const VariablePointer &a);
+VariablePointer f38(const VariablePointer &a);
+VariablePointer f39(const VariablePointer &a);
+VariablePointer fake_main(const VariablePointer &args);
+namespace nabd_snippet29_lits {
+extern const VariablePointer lit0;
+extern const VariablePointer lit1;
+extern const VariablePointer lit2;
+}
+using namespace nabd_snippet29_lits;
@@ -0,0 +1,69 @@
+#include "snippet29_decls.hpp"
+namespace nabd_snippet29_lits {
+const VariablePointer lit0 = std::make_shared<StringVariable>("a");
+const VariablePointer lit1 = std::make_shared<StringVariable>("b");
+const VariablePointer lit2 = std::make_shared<NumberVariable>(0);
+}
+VariablePointer f0(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f1(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f2(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f3(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f4(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f5(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f6(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f7(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f8(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f9(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f10(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f11(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f12(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f13(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f14(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f15(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f16(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f17(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f18(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f19(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f20(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
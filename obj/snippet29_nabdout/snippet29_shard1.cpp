@@ -0,0 +1,79 @@
+#include "snippet29_decls.hpp"
+VariablePointer f21(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f22(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f23(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f24(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f25(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f26(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f27(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f28(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f29(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f30(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f31(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f32(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f33(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f34(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f35(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f36(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f37(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f38(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer f39(const VariablePointer &a) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(print(lit0)), std::dynamic_pointer_cast<Variable>(print(lit1)), std::dynamic_pointer_cast<Variable>(len(a)),  }));
+}
+VariablePointer fake_main(const VariablePointer &args) {
+    return std::make_shared<ListVariable>(std::vector<VariablePointer>({ std::dynamic_pointer_cast<Variable>(f0(args)), std::dynamic_pointer_cast<Variable>(f1(args)), std::dynamic_pointer_cast<Variable>(f2(args)), std::dynamic_pointer_cast<Variable>(f3(args)), std::dynamic_pointer_cast<Variable>(f4(args)), std::dynamic_pointer_cast<Variable>(f5(args)), std::dynamic_pointer_cast<Variable>(f6(args)), std::dynamic_pointer_cast<Variable>(f7(args)), std::dynamic_pointer_cast<Variable>(f8(args)), std::dynamic_pointer_cast<Variable>(f9(args)), std::dynamic_pointer_cast<Variable>(f10(args)), std::dynamic_pointer_cast<Variable>(f11(args)), std::dynamic_pointer_cast<Variable>(f12(args)), std::dynamic_pointer_cast<Variable>(f13(args)), std::dynamic_pointer_cast<Variable>(f14(args)), std::dynamic_pointer_cast<Variable>(f15(args)), std::dynamic_pointer_cast<Variable>(f16(args)), std::dynamic_pointer_cast<Variable>(f17(args)), std::dynamic_pointer_cast<Variable>(f18(args)), std::dynamic_pointer_cast<Variable>(f19(args)), std::dynamic_pointer_cast<Variable>(f20(args)), std::dynamic_pointer_cast<Variable>(f21(args)), std::dynamic_pointer_cast<Variable>(f22(args)), std::dynamic_pointer_cast<Variable>(f23(args)), std::dynamic_pointer_cast<Variable>(f24(args)), std::dynamic_pointer_cast<Variable>(f25(args)), std::dynamic_pointer_cast<Variable>(f26(args)), std::dynamic_pointer_cast<Variable>(f27(args)), std::dynamic_pointer_cast<Variable>(f28(args)), std::dynamic_pointer_cast<Variable>(f29(args)), std::dynamic_pointer_cast<Variable>(f30(args)), std::dynamic_pointer_cast<Variable>(f31(args)), std::dynamic_pointer_cast<Variable>(f32(args)), std::dynamic_pointer_cast<Variable>(f33(args)), std::dynamic_pointer_cast<Variable>(f34(args)), std::dynamic_pointer_cast<Variable>(f35(args)), std::dynamic_pointer_cast<Variable>(f36(args)), std::dynamic_pointer_cast<Variable>(f37(args)), std::dynamic_pointer_cast<Variable>(f38(args)), std::dynamic_pointer_cast<Variable>(f39(args)), std::dynamic_pointer_cast<Variable>(lit2),  }));
+}
+int main(int argc, char **args) {
+  std::vector<VariablePointer> argVars;
+  for(int i = 1; i < argc; i++) {
+    argVars.push_back(
+      std::make_shared<StringVariable>(
+        std::string(args[i])
+      )
+    );
+  }
+  const auto retVal = fake_main(
+    std::make_shared<ListVariable>(argVars)
+  );
+  return static_cast<int>(
+    std::dynamic_pointer_cast<NumberVariable>(
+      retVal->toNumber()
+    )->value
+  );
+}
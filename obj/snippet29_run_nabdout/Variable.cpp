@@ -0,0 +1,264 @@
+#include <string>
+#include <utility>
+#include <sstream>
+#include <vector>
+#include <memory>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <cstdio>
+#include <Variable.hpp>
+VariablePointer listHelper(
+        VariablePointer self,
+        const std::vector<VariableType> &subTypes) {
+    switch(subTypes[0]) {
+        case VariableType::List: {
+            std::vector<VariableType> subSubTypes;
+            for(const auto &type : subTypes) {
+                if(type == *(subTypes.begin())) {
+                    continue;
+                }
+                subSubTypes.push_back(type);
+            }
+            return std::make_shared<ListVariable>(
+                std::vector<VariablePointer>({
+                    self->toList(subSubTypes)
+                })
+            );
+        }
+        case VariableType::Number:
+            return std::make_shared<ListVariable>(
+                std::vector<VariablePointer>({ self->toNumber() })
+            );
+        case VariableType::String:
+            return std::make_shared<ListVariable>(
+                std::vector<VariablePointer>({ self->toString() })
+            );
+        case VariableType::Tuple:
+            return std::make_shared<ListVariable>(
+                std::vector<VariablePointer>({ self->toTuple() })
+            );
+        default:
+            return std::make_shared<ListVariable>(
+                std::vector<VariablePointer>({
+                    std::make_shared<StringVariable>(
+                        "randomly created list lol oops"
+                    )
+                })
+            );
+    }
+}
+StringVariable::StringVariable(const std::string &data) : value(data) {}
+VariablePointer StringVariable::toString(void) const {
+    return std::make_shared<StringVariable>(value);
+}
+VariablePointer StringVariable::toNumber(void) const {
+    return std::make_shared<NumberVariable>(
+        value.length() > 0 ? static_cast<double>(value[0]) : 0
+    );
+}
+VariablePointer StringVariable::toList(
+        const std::vector<VariableType> &subTypes) const {
+    return listHelper(
+        std::make_shared<StringVariable>(value), subTypes
+    );
+}
+VariablePointer StringVariable::toTuple(void) const {
+    return std::make_shared<TupleVariable>(std::make_pair(
+        std::make_shared<StringVariable>(value),
+        std::make_shared<StringVariable>(value)
+    ));
+}
+NumberVariable::NumberVariable(const double data) : value(data) { }
+VariablePointer NumberVariable::toString(void) const {
+    return std::make_shared<StringVariable>(std::to_string(value));
+}
+VariablePointer NumberVariable::toNumber(void) const {
+    return std::make_shared<NumberVariable>(value);
+}
+VariablePointer NumberVariable::toList(
+        const std::vector<VariableType> &subTypes) const {
+    return listHelper(
+        std::make_shared<NumberVariable>(value), subTypes
+    );
+}
+VariablePointer NumberVariable::toTuple(void) const {
+    return std::make_shared<TupleVariable>(std::make_pair(
+        std::make_shared<NumberVariable>(value),
+        std::make_shared<NumberVariable>(value)
+    ));
+}
+TupleVariable::TupleVariable(
+        const std::pair<VariablePointer, VariablePointer> &data) :
+        values(data) { }
+VariablePointer TupleVariable::toString(void) const {
+    return std::make_shared<StringVariable>(
+        "(" +
+            std::dynamic_pointer_cast<StringVariable>(
+                values.first->toString()
+            )->value + ", "
+            + std::dynamic_pointer_cast<StringVariable>(
+                values.second->toString()
+            )->value + ")"
+    );
+}
+VariablePointer TupleVariable::toNumber(void) const {
+    return std::make_shared<NumberVariable>(
+        std::dynamic_pointer_cast<NumberVariable>(
+            values.first->toNumber()
+        )->value
+    );
+}
+VariablePointer TupleVariable::toList(
+        const std::vector<VariableType> &subTypes) const {
+    return listHelper(
+        std::make_shared<TupleVariable>(values), subTypes
+    );
+}
+VariablePointer TupleVariable::toTuple(void) const {
+    return std::make_shared<TupleVariable>(TupleVariable(values));
+}
+ListVariable::ListVariable(
+        const std::vector<VariablePointer> &data) :
+        values(data) {
+}
+VariablePointer ListVariable::toString(void) const {
+    std::stringstream listStr;
+    listStr << "{";
+    for(size_t i = 0; i < values.size(); i++) {
+        listStr <<
+            std::dynamic_pointer_cast<StringVariable>(
+                values[i]->toString()
+            )->value;
+        if(i > 0) {
+            listStr << ", ";
+        }
+    }
+    return std::make_shared<StringVariable>(listStr.str());
+}
+VariablePointer ListVariable::toNumber(void) const {
+    return std::make_shared<NumberVariable>(
+        std::dynamic_pointer_cast<NumberVariable>(
+            values[0]->toNumber()
+        )->value
+    );
+}
+VariablePointer ListVariable::toList(
+        const std::vector<VariableType> &subTypes) const {
+    return std::make_shared<ListVariable>(values);
+}
+VariablePointer ListVariable::toTuple(void) const {
+    return std::make_shared<TupleVariable>(std::make_pair(
+        std::make_shared<ListVariable>(values),
+        std::make_shared<ListVariable>(values)
+    ));
+}
+size_t variableHash(const VariablePointer &var) {
+    const auto combine = [](const size_t seed, const size_t hash) {
+        return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    const auto str = dynamic_cast<const StringVariable *>(var.get());
+    const auto num = dynamic_cast<const NumberVariable *>(var.get());
+    const auto tup = dynamic_cast<const TupleVariable *>(var.get());
+    const auto list = dynamic_cast<const ListVariable *>(var.get());
+    if(str != nullptr) {
+        return combine(1, std::hash<std::string>()(str->value));
+    } else if(num != nullptr) {
+        return combine(2, std::hash<double>()(num->value + 0.0));
+    } else if(tup != nullptr) {
+        return combine(
+            combine(3, variableHash(tup->values.first)),
+            variableHash(tup->values.second)
+        );
+    }
+    size_t hash = 4;
+    for(const auto &item : list->values) {
+        hash = combine(hash, variableHash(item));
+    }
+    return hash;
+}
+bool variablesEqual(
+        const VariablePointer &left, const VariablePointer &right) {
+    if(left == right) {
+        return true;
+    }
+    const auto str = dynamic_cast<const StringVariable *>(left.get());
+    const auto num = dynamic_cast<const NumberVariable *>(left.get());
+    const auto tup = dynamic_cast<const TupleVariable *>(left.get());
+    const auto list = dynamic_cast<const ListVariable *>(left.get());
+    if(str != nullptr) {
+        const auto other =
+            dynamic_cast<const StringVariable *>(right.get());
+        return other != nullptr && other->value == str->value;
+    } else if(num != nullptr) {
+        const auto other =
+            dynamic_cast<const NumberVariable *>(right.get());
+        return other != nullptr && other->value == num->value;
+    } else if(tup != nullptr) {
+        const auto other =
+            dynamic_cast<const TupleVariable *>(right.get());
+        return other != nullptr
+            && variablesEqual(tup->values.first, other->values.first)
+            && variablesEqual(
+                tup->values.second, other->values.second
+            );
+    }
+    const auto other = dynamic_cast<const ListVariable *>(right.get());
+    if(other == nullptr
+            || other->values.size() != list->values.size()) {
+        return false;
+    }
+    for(size_t i = 0; i < list->values.size(); i++) {
+        if(!variablesEqual(list->values[i], other->values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+size_t MemoTable::KeyHash::operator()(
+        const VariablePointer &var) const {
+    return variableHash(var);
+}
+bool MemoTable::KeyEqual::operator()(
+        const VariablePointer &left,
+        const VariablePointer &right) const {
+    return variablesEqual(left, right);
+}
+MemoTable::MemoTable(const char *name, const size_t maxEntries) :
+        funcName(name), capacity(maxEntries), hits(0), misses(0),
+        evictions(0) {
+}
+MemoTable::~MemoTable(void) {
+    if(hits + misses > 0) {
+        std::fprintf(
+            stderr,
+            "Memoized '%s': %zu hits, %zu misses, %zu evicted\n",
+            funcName, hits, misses, evictions
+        );
+    }
+}
+bool MemoTable::find(
+        const VariablePointer &arg, VariablePointer &result) {
+    const auto entry = byArg.find(arg);
+    if(entry == byArg.end()) {
+        misses++;
+        return false;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, entry->second);
+    result = entry->second->second;
+    return true;
+}
+void MemoTable::insert(
+        const VariablePointer &arg, const VariablePointer &result) {
+    if(capacity == 0 || byArg.count(arg) > 0) {
+        return;
+    }
+    if(entries.size() >= capacity) {
+        byArg.erase(entries.back().first);
+        entries.pop_back();
+        evictions++;
+    }
+    entries.push_front({ arg, result });
+    byArg[arg] = entries.begin();
+}
@@ -0,0 +1,439 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of whole-program build file generation
+ */
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <set>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <ModuleCache.hpp>
+#include <CodeGen.hpp>
+#include <BuildGraph.hpp>
+#include <Driver.hpp>
+
+using namespace nabd;
+
+// Each function gets its own section, so linking can drop unused ones
+const std::string g_ninjaCppFlags =
+    "-O2 -Wall -Werror -std=c++17 -ffunction-sections -fdata-sections";
+
+// Ninja treats '$', ' ' and ':' specially in paths
+std::string ninjaPath(const std::string &path) {
+    std::stringstream escaped;
+    for(const auto c : path) {
+        if(c == '$' || c == ' ' || c == ':') {
+            escaped << '$';
+        }
+        escaped << c;
+    }
+    return escaped.str();
+}
+
+std::string jsonString(const std::string &str) {
+    std::stringstream escaped;
+    escaped << '"';
+    for(const auto c : str) {
+        if(c == '"' || c == '\\') {
+            escaped << '\\';
+        }
+        escaped << c;
+    }
+    escaped << '"';
+    return escaped.str();
+}
+
+std::string folderPrefix(const std::string &folder) {
+    return folder != "" ? (folder + "/") : "";
+}
+
+// The module's build folder must come last so real headers take priority
+std::string cppIncludeFlags(const ModuleNode &module) {
+    std::stringstream inc;
+    for(const auto &folder : module.includeFolders) {
+        inc << "\"-I" << (folder != "" ? folder : ".") << "\" ";
+    }
+    inc << "\"-I" << module.modInfo.buildFolder << "\"";
+    return inc.str();
+}
+
+std::string nabcFlags(const InputArguments &inputs) {
+    std::stringstream flags;
+    for(const auto &folder : inputs.includeFolders) {
+        flags << "-I \"" << folder << "\" ";
+    }
+    if(inputs.anf) {
+        flags << "--anf ";
+    }
+    if(inputs.cBackend) {
+        flags << "--backend c --cc \"" << inputs.cCompiler << "\" ";
+    }
+    if(inputs.debug) {
+        flags << "--debug ";
+    }
+    if(inputs.stackMegabytes > 0) {
+        flags << "--stack " << inputs.stackMegabytes << " ";
+    }
+    if(inputs.inlineSize != InputArguments().inlineSize) {
+        flags << "--inline " << inputs.inlineSize << " ";
+    }
+    if(inputs.importInlineSize != InputArguments().importInlineSize) {
+        flags << "--inline-imports " << inputs.importInlineSize << " ";
+    }
+    if(inputs.memoEntries > 0) {
+        flags << "--memoize " << inputs.memoEntries << " ";
+    }
+    return flags.str();
+}
+
+std::string linkFlags(const InputArguments &inputs) {
+    std::stringstream flags;
+    for(const auto &folder : inputs.linkFolders) {
+        flags << "-L\"" << folder << "\" ";
+    }
+    for(const auto &lib : inputs.libraryNames) {
+        flags << "-l" << lib << " ";
+    }
+    const auto stdLibFolder =
+        inputs.cBackend ? "" : findStdLibFolder(inputs);
+    if(stdLibFolder != "") {
+        flags << "-L\"" << stdLibFolder << "\" -lnabdstd ";
+    }
+    if(!inputs.cBackend) {
+        flags << "-Wl,--gc-sections ";
+    }
+    flags << "-lm";
+    return flags.str();
+}
+
+ModuleInfo programInfo(const InputArguments &inputs) {
+    InputArguments programInputs;
+    programInputs.fileName =
+        inputs.outputName != "" ?
+            inputs.outputName :
+            moduleInfoFor(inputs).moduleName;
+    return moduleInfoFor(programInputs);
+}
+
+std::string objectPath(const ModuleInfo &modInfo) {
+    return modInfo.buildFolder + "/" + modInfo.moduleName + ".o";
+}
+
+// The C backend compiles its own runtime (and C) with the chosen compiler
+std::string compilerName(const InputArguments &inputs) {
+    return inputs.cBackend ? inputs.cCompiler : "g++";
+}
+
+std::string compileFlags(const InputArguments &inputs) {
+    return inputs.cBackend ? cCompileFlags(inputs) : g_ninjaCppFlags;
+}
+
+std::string runtimeName(const InputArguments &inputs) {
+    return inputs.cBackend ? "NabdRuntime" : "Variable";
+}
+
+std::string runtimeHeader(const InputArguments &inputs) {
+    return runtimeName(inputs) + (inputs.cBackend ? ".h" : ".hpp");
+}
+
+std::string shardPath(
+        const ModuleNode &module, const size_t shard, const std::string &ext) {
+    return module.modInfo.buildFolder + "/"
+        + codegen::shardName(module.modInfo, shard, module.shardCount) + ext;
+}
+
+std::vector<ModuleNode> nabd::collectModules(const InputArguments &inputs) {
+    std::vector<ModuleNode> modules;
+    std::set<std::string> seen;
+    std::vector<std::string> toVisit({ inputs.fileName });
+
+    while(!toVisit.empty()) {
+        const auto fileName = toVisit.back();
+        toVisit.pop_back();
+        if(seen.count(fileName) > 0) {
+            continue;
+        }
+        seen.insert(fileName);
+
+        auto moduleInputs = inputs;
+        moduleInputs.fileName = fileName;
+        const auto modInfo = moduleInfoFor(moduleInputs);
+        moduleInputs.includeFolders.push_back(modInfo.relativeDirectory);
+
+        const auto program = loadModule(fileName);
+        const auto deps = moduleDependencies(*program, moduleInputs, modInfo);
+        for(const auto &dep : deps) {
+            if(dep.length() > 5 && dep.substr(dep.length() - 5) == ".nabd"
+                    && dep != fileName) {
+                toVisit.push_back(dep);
+            }
+        }
+
+        modules.push_back({ modInfo, moduleInputs.includeFolders, deps, 0 });
+    }
+
+    return modules;
+}
+
+std::vector<std::string> nabd::moduleDependencies(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo) {
+    std::vector<std::string> deps({ modInfo.fileName });
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type != TokenType::Include) {
+            continue;
+        }
+        const auto location = findModule(
+            topLevelTok.children[1].value, cliInputs
+        );
+        deps.push_back(location.fileName);
+    }
+    return deps;
+}
+
+std::string nabd::generateDepFile(
+        const std::string &target, const std::vector<std::string> &deps) {
+    std::stringstream depFile;
+    depFile << target << ":";
+    for(const auto &dep : deps) {
+        // Make-style depfiles escape spaces with a backslash
+        depFile << " \\\n  ";
+        for(const auto c : dep) {
+            if(c == ' ') {
+                depFile << '\\';
+            }
+            depFile << c;
+        }
+    }
+    depFile << "\n";
+    return depFile.str();
+}
+
+std::string nabd::generateNinjaFile(
+        const InputArguments &inputs, const std::string &nabcPath,
+        const std::vector<ModuleNode> &modules) {
+    const auto progInfo = programInfo(inputs);
+    const auto progName = ninjaPath(
+        folderPrefix(progInfo.relativeDirectory) + progInfo.moduleName
+    );
+    const auto runtimeFolder = progInfo.buildFolder;
+
+    std::stringstream ninja;
+    ninja
+        << "# Generated by nabc --emit-ninja. Edits will be overwritten!\n"
+        << "ninja_required_version = 1.3\n\n"
+        << "nabc = " << nabcPath << "\n"
+        << "cxx = " << compilerName(inputs) << "\n"
+        << "cxxflags = " << compileFlags(inputs) << "\n"
+        << "nabdflags = " << nabcFlags(inputs) << "\n\n";
+
+    // Regenerate ourselves whenever a module (and so maybe the graph) changes
+    ninja
+        << "rule regen\n"
+        << "  command = $nabc --emit-ninja \"" << inputs.fileName
+        << "\" $nabdflags";
+    if(inputs.outputName != "") {
+        ninja << " -o \"" << inputs.outputName << "\"";
+    }
+    for(const auto &folder : inputs.linkFolders) {
+        ninja << " -L \"" << folder << "\"";
+    }
+    for(const auto &lib : inputs.libraryNames) {
+        ninja << " -l " << lib;
+    }
+    for(const auto &obj : inputs.objects) {
+        ninja << " \"" << obj << "\"";
+    }
+    ninja
+        << "\n  description = Regenerating build.ninja\n"
+        << "  generator = 1\n"
+        << "  restat = 1\n\n";
+
+    ninja
+        << "rule cxx\n"
+        << "  command = $cxx " << (inputs.cBackend ? "-MD" : "-MMD")
+        << " -MF $out.d $cxxflags $incflags "
+        << "-c $in -o $out\n"
+        << "  depfile = $out.d\n"
+        << "  deps = gcc\n"
+        << "  description = " << (inputs.cBackend ? "CC" : "CXX")
+        << " $out\n\n"
+        << "rule partial\n"
+        << "  command = ld -r -o $out $in\n"
+        << "  description = LD -r $out\n\n"
+        << "rule link\n"
+        << "  command = $cxx -o $out $in $ldflags\n"
+        << "  description = LINK $out\n\n";
+
+    const auto runtimeSrc =
+        runtimeFolder + "/" + runtimeName(inputs)
+        + codegen::sourceExtension(inputs);
+    /*
+     * Working out the shard counts means translating every module, so the
+     * generated sources come from the same step. Unchanged ones are left
+     * alone, so only the shards that changed get recompiled
+     */
+    ninja << "build build.ninja compile_commands.json "
+        << ninjaPath(runtimeFolder + "/" + runtimeHeader(inputs)) << " "
+        << ninjaPath(runtimeSrc);
+    for(const auto &module : modules) {
+        for(size_t i = 0; i < module.shardCount; i++) {
+            ninja << " " << ninjaPath(
+                shardPath(module, i, codegen::sourceExtension(inputs))
+            );
+        }
+        if(module.shardCount > 1) {
+            ninja << " " << ninjaPath(
+                module.modInfo.buildFolder + "/"
+                    + codegen::declarationsName(module.modInfo)
+            );
+        }
+    }
+    ninja << ": regen";
+    std::set<std::string> sources;
+    for(const auto &module : modules) {
+        for(const auto &dep : module.dependencies) {
+            if(sources.insert(dep).second) {
+                ninja << " " << ninjaPath(dep);
+            }
+        }
+    }
+    ninja << "\n\n";
+
+    std::stringstream objs;
+    for(const auto &module : modules) {
+        std::stringstream shardObjs;
+        for(size_t i = 0; i < module.shardCount; i++) {
+            const auto shardObj = ninjaPath(shardPath(module, i, ".o"));
+            ninja
+                << "build " << shardObj << ": cxx "
+                << ninjaPath(
+                    shardPath(module, i, codegen::sourceExtension(inputs))
+                ) << "\n"
+                << "  incflags = " << cppIncludeFlags(module) << "\n";
+            shardObjs << " " << shardObj;
+        }
+        const auto obj = ninjaPath(objectPath(module.modInfo));
+        if(module.shardCount > 1) {
+            ninja << "build " << obj << ": partial" << shardObjs.str() << "\n";
+        }
+        ninja << "\n";
+        objs << " " << obj;
+    }
+
+    const auto runtimeObj =
+        ninjaPath(runtimeFolder + "/" + runtimeName(inputs) + ".o");
+    ninja
+        << "build " << runtimeObj << ": cxx " << ninjaPath(runtimeSrc) << "\n"
+        << "  incflags = \"-I" << runtimeFolder << "\"\n\n";
+    objs << " " << runtimeObj;
+    for(const auto &obj : inputs.objects) {
+        objs << " " << ninjaPath(obj);
+    }
+
+    ninja
+        << "build " << progName << ": link" << objs.str() << "\n"
+        << "  ldflags = " << linkFlags(inputs) << "\n\n"
+        << "default " << progName << "\n";
+
+    return ninja.str();
+}
+
+std::string nabd::generateCompileCommands(
+        const InputArguments &inputs, const std::vector<ModuleNode> &modules) {
+    const auto curDir = getCurrentDir();
+    const auto runtimeFolder = programInfo(inputs).buildFolder;
+
+    std::vector<std::pair<std::string, std::string>> units;
+    for(const auto &module : modules) {
+        for(size_t i = 0; i < module.shardCount; i++) {
+            units.push_back({
+                shardPath(module, i, codegen::sourceExtension(inputs)),
+                cppIncludeFlags(module)
+            });
+        }
+    }
+    units.push_back({
+        runtimeFolder + "/" + runtimeName(inputs)
+            + codegen::sourceExtension(inputs),
+        "\"-I" + runtimeFolder + "\""
+    });
+
+    std::stringstream json;
+    json << "[\n";
+    for(size_t i = 0; i < units.size(); i++) {
+        const auto &file = units[i].first;
+        const auto obj = file.substr(0, file.find_last_of('.')) + ".o";
+        json
+            << "  {\n"
+            << "    \"directory\": " << jsonString(curDir) << ",\n"
+            << "    \"command\": " << jsonString(
+                compilerName(inputs) + " " + compileFlags(inputs) + " "
+                    + units[i].second
+                    + " -c " + file + " -o " + obj
+            ) << ",\n"
+            << "    \"file\": " << jsonString(file) << ",\n"
+            << "    \"output\": " << jsonString(obj) << "\n"
+            << "  }" << (i + 1 < units.size() ? "," : "") << "\n";
+    }
+    json << "]\n";
+    return json.str();
+}
+
+void nabd::emitNinjaBuild(
+        const InputArguments &inputs, const std::string &nabcPath) {
+    auto modules = collectModules(inputs);
+    for(auto &module : modules) {
+        auto moduleInputs = inputs;
+        moduleInputs.fileName = module.modInfo.fileName;
+        moduleInputs.includeFolders = module.includeFolders;
+        const auto modInfo = extractModuleInfo(moduleInputs);
+        const auto program = loadModule(modInfo.fileName);
+        const auto code = compile(*program, moduleInputs, modInfo);
+        translate(*program, code, moduleInputs, modInfo);
+        module.shardCount = code.shards.size();
+    }
+    const auto progInfo = programInfo(inputs);
+
+    // The runtime is shared by every module, so it's written once up front
+    if(!dirExists(progInfo.buildFolder)) {
+        logOut()
+            << "Build folder '" << progInfo.buildFolder
+            << "' does not exist. Creating!" << std::endl;
+    }
+    createDirectory(progInfo.buildFolder);
+    if(inputs.cBackend) {
+        if(!writeFileIfChanged(
+                progInfo.buildFolder + "/NabdRuntime.h", g_cRuntimeH)
+                || !writeFileIfChanged(
+                    progInfo.buildFolder + "/NabdRuntime.c", g_cRuntimeC)) {
+            errorOut("Failed to create the C runtime!");
+        }
+    } else {
+        if(!writeFileIfChanged(
+                progInfo.buildFolder + "/Variable.hpp", g_varHpp)) {
+            errorOut("Failed to create the Variable.hpp file!");
+        }
+        if(!writeFileIfChanged(
+                progInfo.buildFolder + "/Variable.cpp", g_varCpp)) {
+            errorOut("Failed to create the Variable.cpp file!");
+        }
+    }
+
+    if(!writeFileIfChanged(
+            "build.ninja", generateNinjaFile(inputs, nabcPath, modules))) {
+        errorOut("Failed to create build.ninja!");
+    }
+    if(!writeFileIfChanged(
+            "compile_commands.json",
+            generateCompileCommands(inputs, modules))) {
+        errorOut("Failed to create compile_commands.json!");
+    }
+    logOut()
+        << "Wrote build.ninja and compile_commands.json for "
+        << modules.size() << " module(s)" << std::endl;
+}
@@ -0,0 +1,384 @@
+/*
+ * Author: Dylan Turner
+ * Description: Convert a program token into a plain C99 program
+ */
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <CodeGen.hpp>
+#include <ModuleCache.hpp>
+
+using namespace nabd;
+
+// Prefixed so nabd names can't clash with libc (round, floor, random, ...)
+std::string cFuncName(const std::string &name) {
+    return "nabd_fn_" + name;
+}
+
+std::string cForwardDecl(const Token &funcDef) {
+    return "NabdVar *" + cFuncName(funcDef.children[0].value)
+        + "(NabdVar *" + funcDef.children[2].value + ");\n";
+}
+
+/*
+ * Every value is reference counted. Parameters are borrowed and every
+ * function hands back a reference its caller owns, so each temporary is
+ * released once it's been used. Like the C++ ANF lowering, every call,
+ * tuple and list gets its own temporary, which is also what makes keeping
+ * track of what to release simple
+ */
+struct CLowering {
+    std::string &out;
+    std::string tempPrefix;
+    size_t nextTemp;
+
+    // Temporaries owned by each enclosing block, innermost last
+    std::vector<std::vector<std::string>> scopes;
+
+    void indent(const size_t depth) {
+        out.append(depth * 4, ' ');
+    }
+
+    std::string newTemp(void) {
+        return tempPrefix + std::to_string(nextTemp++);
+    }
+
+    // A parameter (borrowed) or a temporary owned by the current block
+    std::string atom(const Token &expr, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Identifier) {
+            return subExpr.value;
+        }
+
+        const auto name = newTemp();
+        if(subExpr.type == TokenType::Ternary) {
+            indent(depth);
+            out += "NabdVar *" + name + ";\n";
+            branch(subExpr, name, depth);
+        } else {
+            const auto code = value(expr, depth);
+            indent(depth);
+            out += "NabdVar *" + name + " = " + code + ";\n";
+        }
+        scopes.back().push_back(name);
+        return name;
+    }
+
+    // A reference to hand over to a tuple or list, which then owns it
+    std::string owned(const Token &expr, const size_t depth) {
+        const auto name = atom(expr, depth);
+        auto &scope = scopes.back();
+        const auto temp = std::find(scope.begin(), scope.end(), name);
+        if(temp == scope.end()) {
+            return "nabd_ref(" + name + ")";
+        }
+        scope.erase(temp);
+        return name;
+    }
+
+    // Code for a new reference to a non-ternary expression's value
+    std::string value(const Token &expr, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        switch(subExpr.type) {
+            case TokenType::FuncCall:
+                return cFuncName(subExpr.children[0].value) + "("
+                    + atom(subExpr.children[2], depth) + ")";
+
+            case TokenType::TupDef: {
+                const auto first = owned(subExpr.children[1], depth);
+                const auto second = owned(subExpr.children[3], depth);
+                return "nabd_tuple(" + first + ", " + second + ")";
+            }
+
+            case TokenType::ListDef: {
+                std::string elems;
+                size_t count = 0;
+                for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
+                    elems += ", " + owned(subExpr.children[i], depth);
+                    count++;
+                }
+                return "nabd_list_of(" + std::to_string(count) + elems + ")";
+            }
+
+            case TokenType::String:
+                return "nabd_cstring(\"" + subExpr.value + "\")";
+
+            case TokenType::Decimal:
+                return "nabd_number(" + subExpr.value + ")";
+
+            case TokenType::Hex:
+                return "nabd_number((double) 0x" + subExpr.value + ")";
+
+            case TokenType::Identifier:
+                return "nabd_ref(" + subExpr.value + ")";
+
+            default:
+                return "";
+        }
+    }
+
+    void release(const std::vector<std::string> &temps, const size_t depth) {
+        for(const auto &temp : temps) {
+            indent(depth);
+            out += "nabd_unref(" + temp + ");\n";
+        }
+    }
+
+    // Sends a value to dest, or returns it from the function if dest is ""
+    void store(const Token &expr, const std::string &dest, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Ternary) {
+            branch(subExpr, dest, depth);
+            return;
+        }
+        const auto code = value(expr, depth);
+        if(dest != "") {
+            indent(depth);
+            out += dest + " = " + code + ";\n";
+            return;
+        }
+
+        // Returning leaves every enclosing block, so release all of them
+        bool ownsTemps = false;
+        for(const auto &scope : scopes) {
+            ownsTemps = ownsTemps || !scope.empty();
+        }
+        if(!ownsTemps) {
+            indent(depth);
+            out += "return " + code + ";\n";
+            return;
+        }
+        const auto result = newTemp();
+        indent(depth);
+        out += "NabdVar *" + result + " = " + code + ";\n";
+        for(const auto &scope : scopes) {
+            release(scope, depth);
+        }
+        indent(depth);
+        out += "return " + result + ";\n";
+    }
+
+    void branch(const Token &ternary, const std::string &dest, size_t depth) {
+        const auto cond = atom(ternary.children[1], depth);
+        indent(depth);
+        out += "if(nabd_truthy(" + cond + ")) {\n";
+        arm(ternary.children[3], dest, depth + 1);
+        indent(depth);
+        out += "} else {\n";
+        arm(ternary.children[5], dest, depth + 1);
+        indent(depth);
+        out += "}\n";
+    }
+
+    void arm(const Token &expr, const std::string &dest, const size_t depth) {
+        scopes.push_back(std::vector<std::string>());
+        store(expr, dest, depth);
+        if(dest != "") {
+            release(scopes.back(), depth);
+        }
+        scopes.pop_back();
+    }
+
+    static const Token &unwrap(const Token &expr) {
+        return expr.type == TokenType::Identifier ? expr : expr.children[0];
+    }
+};
+
+void codegen::generateCFuncDefCode(const Token &funcDef, std::string &out) {
+    out += "NabdVar *";
+    out += cFuncName(funcDef.children[0].value);
+    out += "(NabdVar *";
+    out += funcDef.children[2].value;
+    out += ") {\n";
+    CLowering lowering = {
+        out, tempPrefix(funcDef), 0,
+        std::vector<std::vector<std::string>>(1)
+    };
+    lowering.store(funcDef.children[4], "", 1);
+    out += "}\n";
+}
+
+// C has no modules of its own, so std is the only C++ module it can use
+std::string generateCIncludeCode(
+        const Token &include,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo) {
+    const auto ident = include.children[1].value;
+    ModuleLocation location;
+    try {
+        location = findModule(ident, cliInputs);
+    } catch(CompileError &e) {
+        e.line = include.children[1].line;
+        e.col = include.children[1].col;
+        throw;
+    }
+
+    if(location.isCpp) {
+        if(ident == "std") {
+            return "#include <NabdStd.h>";
+        }
+        errorOut(
+            "The C backend can't include the C++ module '" + ident + "'!",
+            include.children[1].line, include.children[1].col
+        );
+    }
+
+    // Declare the other module's functions in a header of our own
+    const auto prog = loadModule(location.fileName);
+    std::stringstream headerCode;
+    headerCode
+        << "#ifndef NABD_MODULE_" << ident << "_H\n"
+        << "#define NABD_MODULE_" << ident << "_H\n"
+        << "#include <NabdRuntime.h>\n";
+    for(const auto &topLevelTok : prog->children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            headerCode << cForwardDecl(topLevelTok);
+        }
+    }
+    headerCode << "#endif\n";
+
+    const auto fileName = modInfo.buildFolder + "/" + ident + ".h";
+    if(!writeFileIfChanged(fileName, headerCode.str())) {
+        errorOut(
+            "Failed to create header file for included module '"
+                + ident + "'!"
+        );
+    }
+    return "#include <" + ident + ".h>";
+}
+
+// The real main, on a thread with a bigger stack for --stack
+std::string generateCMainCode(const InputArguments &cliInputs) {
+    const std::string argVarsCode =
+        "    NabdVar *argVars = nabd_list(argc > 1 ? argc - 1 : 0);\n"
+        "    int i;\n";
+    const std::string fillArgsCode =
+        "    for(i = 1; i < argc; i++) {\n"
+        "        argVars->as.list.items[i - 1] = nabd_cstring(args[i]);\n"
+        "    }\n";
+    if(cliInputs.stackMegabytes == 0) {
+        return
+            "int main(int argc, char **args) {\n"
+            + argVarsCode +
+            "    NabdVar *retVal;\n"
+            "    int status;\n"
+            + fillArgsCode +
+            "    retVal = nabd_fn_main(argVars);\n"
+            "    status = (int) nabd_num(retVal);\n"
+            "    nabd_unref(retVal);\n"
+            "    nabd_unref(argVars);\n"
+            "    return status;\n"
+            "}\n";
+    }
+    const auto stackBytes =
+        "(size_t) " + std::to_string(cliInputs.stackMegabytes)
+        + " * 1024 * 1024";
+    return
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "#include <windows.h>\n"
+        "#else\n"
+        "#include <pthread.h>\n"
+        "#endif\n"
+        "\n"
+        "typedef struct {\n"
+        "    NabdVar *args;\n"
+        "    int status;\n"
+        "} NabdMainCall;\n"
+        "\n"
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "static DWORD WINAPI nabd_run_main(LPVOID param) {\n"
+        "#else\n"
+        "static void *nabd_run_main(void *param) {\n"
+        "#endif\n"
+        "    NabdMainCall *call = (NabdMainCall *) param;\n"
+        "    NabdVar *retVal = nabd_fn_main(call->args);\n"
+        "    call->status = (int) nabd_num(retVal);\n"
+        "    nabd_unref(retVal);\n"
+        "    return 0;\n"
+        "}\n"
+        "\n"
+        "int main(int argc, char **args) {\n"
+        + argVarsCode +
+        "    NabdMainCall call;\n"
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "    HANDLE thread;\n"
+        "#else\n"
+        "    pthread_attr_t attr;\n"
+        "    pthread_t thread;\n"
+        "#endif\n"
+        + fillArgsCode +
+        "    call.args = argVars;\n"
+        "    call.status = 1;\n"
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "    thread = CreateThread(\n"
+        "        NULL, " + stackBytes + ", nabd_run_main, &call,\n"
+        "        STACK_SIZE_PARAM_IS_A_RESERVATION, NULL\n"
+        "    );\n"
+        "    if(thread != NULL) {\n"
+        "        WaitForSingleObject(thread, INFINITE);\n"
+        "        CloseHandle(thread);\n"
+        "    }\n"
+        "#else\n"
+        "    pthread_attr_init(&attr);\n"
+        "    pthread_attr_setstacksize(&attr, " + stackBytes + ");\n"
+        "    if(pthread_create(&thread, &attr, nabd_run_main, &call) == 0) {\n"
+        "        pthread_join(thread, NULL);\n"
+        "    }\n"
+        "    pthread_attr_destroy(&attr);\n"
+        "#endif\n"
+        "    nabd_unref(argVars);\n"
+        "    return call.status;\n"
+        "}\n";
+}
+
+codegen::ModuleCode codegen::generateCModuleCode(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo) {
+    if(!dirExists(modInfo.buildFolder)) {
+        logOut()
+            << "Build folder '" << modInfo.buildFolder
+            << "' does not exist. Creating!" << std::endl;
+    }
+    createDirectory(modInfo.buildFolder);
+
+    std::string code = "#include <NabdRuntime.h>\n";
+    bool hasMain = false;
+    for(const auto &topLevelTok : program.children) {
+        switch(topLevelTok.type) {
+            case TokenType::FuncDef:
+                code += cForwardDecl(topLevelTok);
+                hasMain = hasMain || topLevelTok.children[0].value == "main";
+                break;
+
+            case TokenType::Include:
+                code += generateCIncludeCode(topLevelTok, cliInputs, modInfo);
+                code += "\n";
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            code += "\n";
+            generateCFuncDefCode(topLevelTok, code);
+        }
+    }
+
+    if(hasMain) {
+        code += "\n";
+        code += generateCMainCode(cliInputs);
+    }
+
+    ModuleCode moduleCode;
+    moduleCode.shards.push_back(code);
+    return moduleCode;
+}
@@ -0,0 +1,421 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - The runtime and standard library used by the C backend (--backend c)
+ *  - Values are reference counted. Functions borrow their parameter and
+ *    return a reference the caller owns (see CCodeGen.cpp)
+ *  - Same conversions as the Variable.cpp nabc writes for C++ programs
+ *    (lists print like it, not like lib/src/Variable.cpp) and the same std
+ *    functions as lib/include/std.hpp, which are static in NabdStd.h so a
+ *    module's own functions can't clash with them
+ */
+
+#include <string>
+#include <vector>
+#include <FileIo.hpp>
+
+using namespace nabd;
+
+std::string nabd::cCompileFlags(const InputArguments &inputs) {
+    return std::string("-std=c99 -Wall -Werror ")
+        + (inputs.debug ? "-O0 -g" : "-O2");
+}
+
+const std::vector<std::string> nabd::g_cMakeFile = {
+    "SRC_FILE :=\t\t\t",
+    "", // Insert source file
+    "\nOBJNAME :=\t\t\t",
+    "", // Insert module object file
+    "\nCC :=\t\t\t\t",
+    "", // Insert C compiler
+    "\nCFLAGS :=\t\t\t",
+    "", // Insert compile flags
+    "\nINC :=\t\t\t\t",
+    "", // Insert include folders
+    "\n"
+    ".PHONY : all\n"
+    "all : $(OBJNAME)\n"
+    "$(OBJNAME) : $(SRC_FILE) Makefile\n"
+    "\t$(CC) $(INC) $(CFLAGS) -MD -MF $@.d -c $< -o $@\n"
+    "-include $(OBJNAME).d\n"
+};
+
+const std::string nabd::g_cRuntimeH =
+    "#ifndef NABD_RUNTIME_H\n"
+    "#define NABD_RUNTIME_H\n"
+    "#include <stddef.h>\n"
+    "typedef enum {\n"
+    "    NABD_STRING, NABD_NUMBER, NABD_LIST, NABD_TUPLE\n"
+    "} NabdType;\n"
+    "typedef struct NabdVar NabdVar;\n"
+    "struct NabdVar {\n"
+    "    NabdType type;\n"
+    "    size_t refs;\n"
+    "    union {\n"
+    "        struct { char *data; size_t len; } str;\n"
+    "        double num;\n"
+    "        struct { NabdVar **items; size_t len; } list;\n"
+    "        struct { NabdVar *first, *second; } tup;\n"
+    "    } as;\n"
+    "};\n"
+    "NabdVar *nabd_string(const char *data, size_t len);\n"
+    "NabdVar *nabd_cstring(const char *data);\n"
+    "NabdVar *nabd_number(double value);\n"
+    "NabdVar *nabd_list(size_t len);\n"
+    "NabdVar *nabd_list_of(int count, ...);\n"
+    "NabdVar *nabd_tuple(NabdVar *first, NabdVar *second);\n"
+    "NabdVar *nabd_ref(NabdVar *var);\n"
+    "void nabd_unref(NabdVar *var);\n"
+    "NabdVar *nabd_to_string(NabdVar *var);\n"
+    "NabdVar *nabd_to_number(NabdVar *var);\n"
+    "NabdVar *nabd_to_list(\n"
+    "    NabdVar *var, const NabdType *subTypes, size_t count\n"
+    ");\n"
+    "NabdVar *nabd_to_tuple(NabdVar *var);\n"
+    "double nabd_num(NabdVar *var);\n"
+    "int nabd_truthy(NabdVar *var);\n"
+    "#endif\n";
+
+const std::string nabd::g_cRuntimeC =
+    "#include <stdio.h>\n"
+    "#include <stdlib.h>\n"
+    "#include <string.h>\n"
+    "#include <stdarg.h>\n"
+    "#include \"NabdRuntime.h\"\n"
+    "static NabdVar *nabd_alloc(NabdType type) {\n"
+    "    NabdVar *var = (NabdVar *) malloc(sizeof(NabdVar));\n"
+    "    if(var == NULL) {\n"
+    "        fputs(\"Out of memory!\\n\", stderr);\n"
+    "        exit(1);\n"
+    "    }\n"
+    "    var->type = type;\n"
+    "    var->refs = 1;\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_string(const char *data, size_t len) {\n"
+    "    NabdVar *var = nabd_alloc(NABD_STRING);\n"
+    "    var->as.str.data = (char *) malloc(len + 1);\n"
+    "    memcpy(var->as.str.data, data, len);\n"
+    "    var->as.str.data[len] = '\\0';\n"
+    "    var->as.str.len = len;\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_cstring(const char *data) {\n"
+    "    return nabd_string(data, strlen(data));\n"
+    "}\n"
+    "NabdVar *nabd_number(double value) {\n"
+    "    NabdVar *var = nabd_alloc(NABD_NUMBER);\n"
+    "    var->as.num = value;\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_list(size_t len) {\n"
+    "    NabdVar *var = nabd_alloc(NABD_LIST);\n"
+    "    var->as.list.items =\n"
+    "        (NabdVar **) malloc((len > 0 ? len : 1) * sizeof(NabdVar *));\n"
+    "    var->as.list.len = len;\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_list_of(int count, ...) {\n"
+    "    NabdVar *var = nabd_list((size_t) count);\n"
+    "    va_list items;\n"
+    "    int i;\n"
+    "    va_start(items, count);\n"
+    "    for(i = 0; i < count; i++) {\n"
+    "        var->as.list.items[i] = va_arg(items, NabdVar *);\n"
+    "    }\n"
+    "    va_end(items);\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_tuple(NabdVar *first, NabdVar *second) {\n"
+    "    NabdVar *var = nabd_alloc(NABD_TUPLE);\n"
+    "    var->as.tup.first = first;\n"
+    "    var->as.tup.second = second;\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_ref(NabdVar *var) {\n"
+    "    var->refs++;\n"
+    "    return var;\n"
+    "}\n"
+    "void nabd_unref(NabdVar *var) {\n"
+    "    size_t i;\n"
+    "    if(--var->refs > 0) {\n"
+    "        return;\n"
+    "    }\n"
+    "    switch(var->type) {\n"
+    "        case NABD_STRING:\n"
+    "            free(var->as.str.data);\n"
+    "            break;\n"
+    "        case NABD_LIST:\n"
+    "            for(i = 0; i < var->as.list.len; i++) {\n"
+    "                nabd_unref(var->as.list.items[i]);\n"
+    "            }\n"
+    "            free(var->as.list.items);\n"
+    "            break;\n"
+    "        case NABD_TUPLE:\n"
+    "            nabd_unref(var->as.tup.first);\n"
+    "            nabd_unref(var->as.tup.second);\n"
+    "            break;\n"
+    "        default:\n"
+    "            break;\n"
+    "    }\n"
+    "    free(var);\n"
+    "}\n"
+    "typedef struct {\n"
+    "    char *data;\n"
+    "    size_t len, cap;\n"
+    "} NabdBuffer;\n"
+    "static void nabd_append(\n"
+    "        NabdBuffer *buff, const char *data, size_t len) {\n"
+    "    if(buff->len + len + 1 > buff->cap) {\n"
+    "        buff->cap = (buff->len + len + 1) * 2;\n"
+    "        buff->data = (char *) realloc(buff->data, buff->cap);\n"
+    "    }\n"
+    "    memcpy(buff->data + buff->len, data, len);\n"
+    "    buff->len += len;\n"
+    "}\n"
+    "static void nabd_append_var(NabdBuffer *buff, NabdVar *var) {\n"
+    "    NabdVar *str = nabd_to_string(var);\n"
+    "    nabd_append(buff, str->as.str.data, str->as.str.len);\n"
+    "    nabd_unref(str);\n"
+    "}\n"
+    "static NabdVar *nabd_take_buffer(NabdBuffer *buff) {\n"
+    "    NabdVar *var =\n"
+    "        nabd_string(buff->data != NULL ? buff->data : \"\", buff->len);\n"
+    "    free(buff->data);\n"
+    "    return var;\n"
+    "}\n"
+    "NabdVar *nabd_to_string(NabdVar *var) {\n"
+    "    NabdBuffer buff = { NULL, 0, 0 };\n"
+    "    char num[512];\n"
+    "    size_t i;\n"
+    "    switch(var->type) {\n"
+    "        case NABD_STRING:\n"
+    "            return nabd_ref(var);\n"
+    "        case NABD_NUMBER:\n"
+    "            snprintf(num, sizeof(num), \"%f\", var->as.num);\n"
+    "            return nabd_cstring(num);\n"
+    "        case NABD_TUPLE:\n"
+    "            nabd_append(&buff, \"(\", 1);\n"
+    "            nabd_append_var(&buff, var->as.tup.first);\n"
+    "            nabd_append(&buff, \", \", 2);\n"
+    "            nabd_append_var(&buff, var->as.tup.second);\n"
+    "            nabd_append(&buff, \")\", 1);\n"
+    "            return nabd_take_buffer(&buff);\n"
+    "        default:\n"
+    "            nabd_append(&buff, \"{\", 1);\n"
+    "            for(i = 0; i < var->as.list.len; i++) {\n"
+    "                nabd_append_var(&buff, var->as.list.items[i]);\n"
+    "                if(i > 0) {\n"
+    "                    nabd_append(&buff, \", \", 2);\n"
+    "                }\n"
+    "            }\n"
+    "            return nabd_take_buffer(&buff);\n"
+    "    }\n"
+    "}\n"
+    "double nabd_num(NabdVar *var) {\n"
+    "    switch(var->type) {\n"
+    "        case NABD_STRING:\n"
+    "            return var->as.str.len > 0 ?\n"
+    "                (double) var->as.str.data[0] : 0;\n"
+    "        case NABD_NUMBER:\n"
+    "            return var->as.num;\n"
+    "        case NABD_TUPLE:\n"
+    "            return nabd_num(var->as.tup.first);\n"
+    "        default:\n"
+    "            return var->as.list.len > 0 ?\n"
+    "                nabd_num(var->as.list.items[0]) : 0;\n"
+    "    }\n"
+    "}\n"
+    "NabdVar *nabd_to_number(NabdVar *var) {\n"
+    "    if(var->type == NABD_NUMBER) {\n"
+    "        return nabd_ref(var);\n"
+    "    }\n"
+    "    return nabd_number(nabd_num(var));\n"
+    "}\n"
+    "int nabd_truthy(NabdVar *var) {\n"
+    "    return nabd_num(var) > 0;\n"
+    "}\n"
+    "NabdVar *nabd_to_tuple(NabdVar *var) {\n"
+    "    if(var->type == NABD_TUPLE) {\n"
+    "        return nabd_ref(var);\n"
+    "    }\n"
+    "    return nabd_tuple(nabd_ref(var), nabd_ref(var));\n"
+    "}\n"
+    "NabdVar *nabd_to_list(\n"
+    "        NabdVar *var, const NabdType *subTypes, size_t count) {\n"
+    "    NabdType subSubTypes[16];\n"
+    "    size_t i, subCount = 0;\n"
+    "    NabdVar *list, *str;\n"
+    "    if(var->type == NABD_LIST) {\n"
+    "        return nabd_ref(var);\n"
+    "    }\n"
+    "    switch(count > 0 ? subTypes[0] : NABD_TUPLE) {\n"
+    "        case NABD_LIST:\n"
+    "            for(i = 0; i < count && subCount < 16; i++) {\n"
+    "                if(subTypes[i] != subTypes[0]) {\n"
+    "                    subSubTypes[subCount++] = subTypes[i];\n"
+    "                }\n"
+    "            }\n"
+    "            return nabd_list_of(\n"
+    "                1, nabd_to_list(var, subSubTypes, subCount)\n"
+    "            );\n"
+    "        case NABD_NUMBER:\n"
+    "            return nabd_list_of(1, nabd_to_number(var));\n"
+    "        case NABD_STRING:\n"
+    "            str = nabd_to_string(var);\n"
+    "            list = nabd_list(str->as.str.len);\n"
+    "            for(i = 0; i < str->as.str.len; i++) {\n"
+    "                list->as.list.items[i] =\n"
+    "                    nabd_string(str->as.str.data + i, 1);\n"
+    "            }\n"
+    "            nabd_unref(str);\n"
+    "            return list;\n"
+    "        default:\n"
+    "            return nabd_list_of(1, nabd_to_tuple(var));\n"
+    "    }\n"
+    "}\n";
+
+const std::string nabd::g_cStdH =
+    "#ifndef NABD_STD_H\n"
+    "#define NABD_STD_H\n"
+    "#include <stdio.h>\n"
+    "#include <stdlib.h>\n"
+    "#include <math.h>\n"
+    "#include <time.h>\n"
+    "#include \"NabdRuntime.h\"\n"
+    "static const NabdType nabd_std_tuple[] = { NABD_TUPLE };\n"
+    "static inline NabdVar *nabd_fn_print(NabdVar *msg) {\n"
+    "    NabdVar *str = nabd_to_string(msg);\n"
+    "    fwrite(str->as.str.data, 1, str->as.str.len, stdout);\n"
+    "    return str;\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_input(NabdVar *dummy) {\n"
+    "    NabdVar *str;\n"
+    "    char *data = NULL;\n"
+    "    size_t len = 0, cap = 0;\n"
+    "    int c;\n"
+    "    (void) dummy;\n"
+    "    fflush(stdout);\n"
+    "    while((c = getchar()) != EOF && c != '\\n') {\n"
+    "        if(len + 1 > cap) {\n"
+    "            cap = cap > 0 ? cap * 2 : 64;\n"
+    "            data = (char *) realloc(data, cap);\n"
+    "        }\n"
+    "        data[len++] = (char) c;\n"
+    "    }\n"
+    "    str = nabd_string(data != NULL ? data : \"\", len);\n"
+    "    free(data);\n"
+    "    return str;\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_parseNum(NabdVar *str) {\n"
+    "    NabdVar *strVar = nabd_to_string(str);\n"
+    "    const double num = strtod(strVar->as.str.data, NULL);\n"
+    "    nabd_unref(strVar);\n"
+    "    return nabd_number(num);\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_len(NabdVar *ls) {\n"
+    "    NabdVar *list = nabd_to_list(ls, nabd_std_tuple, 1);\n"
+    "    const double len = (double) list->as.list.len;\n"
+    "    nabd_unref(list);\n"
+    "    return nabd_number(len);\n"
+    "}\n"
+    "#define NABD_STD_COMPARE(name, op) \\\n"
+    "    static inline NabdVar *nabd_fn_##name(NabdVar *tup) { \\\n"
+    "        NabdVar *items = nabd_to_tuple(tup); \\\n"
+    "        const double num1 = nabd_num(items->as.tup.first); \\\n"
+    "        const double num2 = nabd_num(items->as.tup.second); \\\n"
+    "        nabd_unref(items); \\\n"
+    "        return nabd_number(num1 op num2 ? 1 : -1); \\\n"
+    "    }\n"
+    "NABD_STD_COMPARE(gt, >)\n"
+    "NABD_STD_COMPARE(lt, <)\n"
+    "NABD_STD_COMPARE(eq, ==)\n"
+    "NABD_STD_COMPARE(gte, >=)\n"
+    "NABD_STD_COMPARE(lte, <=)\n"
+    "NABD_STD_COMPARE(ne, !=)\n"
+    "#undef NABD_STD_COMPARE\n"
+    "static inline NabdVar *nabd_fn_swap(NabdVar *param) {\n"
+    "    NabdVar *baseList, *newList;\n"
+    "    double ind;\n"
+    "    size_t i;\n"
+    "    if(param->type != NABD_LIST || param->as.list.len < 2) {\n"
+    "        return nabd_ref(param);\n"
+    "    }\n"
+    "    if(param->as.list.len < 3) {\n"
+    "        return nabd_ref(param->as.list.items[1]);\n"
+    "    }\n"
+    "    ind = nabd_num(param->as.list.items[0]);\n"
+    "    baseList =\n"
+    "        nabd_to_list(param->as.list.items[1], nabd_std_tuple, 1);\n"
+    "    if(ind >= (double) baseList->as.list.len) {\n"
+    "        nabd_unref(baseList);\n"
+    "        return nabd_ref(param->as.list.items[1]);\n"
+    "    }\n"
+    "    newList = nabd_list(baseList->as.list.len);\n"
+    "    for(i = 0; i < baseList->as.list.len; i++) {\n"
+    "        newList->as.list.items[i] = nabd_ref(\n"
+    "            ind >= 0 && i == (size_t) floor(ind) ?\n"
+    "                param->as.list.items[2] :\n"
+    "                baseList->as.list.items[i]\n"
+    "        );\n"
+    "    }\n"
+    "    nabd_unref(baseList);\n"
+    "    return newList;\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_seedRandom(NabdVar *dummy) {\n"
+    "    (void) dummy;\n"
+    "    srand((unsigned) time(NULL));\n"
+    "    return nabd_number(0);\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_random(NabdVar *btwn) {\n"
+    "    NabdVar *range = nabd_to_tuple(btwn);\n"
+    "    const double min = nabd_num(range->as.tup.first);\n"
+    "    const double max = nabd_num(range->as.tup.second);\n"
+    "    const double div = (double) RAND_MAX / (max - min);\n"
+    "    nabd_unref(range);\n"
+    "    return nabd_number(min + ((double) rand() / div));\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_round(NabdVar *num) {\n"
+    "    return nabd_number(round(nabd_num(num)));\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_floor(NabdVar *num) {\n"
+    "    return nabd_number(floor(nabd_num(num)));\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_ceil(NabdVar *num) {\n"
+    "    return nabd_number(ceil(nabd_num(num)));\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_elem(NabdVar *param) {\n"
+    "    NabdVar *pair = nabd_to_tuple(param), *list, *item;\n"
+    "    const double ind = nabd_num(pair->as.tup.first);\n"
+    "    list = nabd_to_list(pair->as.tup.second, nabd_std_tuple, 1);\n"
+    "    nabd_unref(pair);\n"
+    "    if(ind < 0 || ind >= (double) list->as.list.len) {\n"
+    "        nabd_unref(list);\n"
+    "        return nabd_ref(param);\n"
+    "    }\n"
+    "    item = nabd_ref(list->as.list.items[(size_t) ind]);\n"
+    "    nabd_unref(list);\n"
+    "    return item;\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_inc(NabdVar *num) {\n"
+    "    return nabd_number(nabd_num(num) + 1);\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_dec(NabdVar *num) {\n"
+    "    return nabd_number(nabd_num(num) - 1);\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_dup(NabdVar *var) {\n"
+    "    return nabd_tuple(nabd_ref(var), nabd_ref(var));\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_fst(NabdVar *param) {\n"
+    "    NabdVar *pair = nabd_to_tuple(param);\n"
+    "    NabdVar *first = nabd_ref(pair->as.tup.first);\n"
+    "    nabd_unref(pair);\n"
+    "    return first;\n"
+    "}\n"
+    "static inline NabdVar *nabd_fn_snd(NabdVar *param) {\n"
+    "    NabdVar *pair = nabd_to_tuple(param);\n"
+    "    NabdVar *second = nabd_ref(pair->as.tup.second);\n"
+    "    nabd_unref(pair);\n"
+    "    return second;\n"
+    "}\n"
+    "#endif\n";
@@ -6,46 +6,749 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cctype>
 #include <Utility.hpp>
 #include <Token.hpp>
 #include <Parser.hpp>
 #include <FileIo.hpp>
 #include <CodeGen.hpp>
+#include <ModuleCache.hpp>
+#include <Parallel.hpp>
+#include <TypeInfer.hpp>
+#include <ConstFold.hpp>
+#include <Inliner.hpp>
+#include <DeadCode.hpp>
+#include <Cse.hpp>
+#include <Sequencing.hpp>
+#include <TailCalls.hpp>
 
 using namespace nabd;
 
+// Aim for shards that take g++ a few seconds, but not so many that parsing
+const size_t g_shardTargetBytes = 32 * 1024;
+const size_t g_shardMinDefs = 16;
+const size_t g_maxShards = 16;
+
+// Past this, nested C++ expressions get very slow (and big) for g++ to compile
+const size_t g_anfMinDepth = 32;
+
+// Starting a thread costs about as much as generating this many functions
+const size_t g_codeGenMinDefsPerThread = 64;
+
+/*
+ * std functions whose (number) results are worked out inline on doubles.
+ * round, floor and ceil would need <cmath> in every module, which costs
+ * more to compile than calling them saves
+ */
+const std::map<std::string, std::string> g_unboxedSteps = {
+    { "inc", " + 1" }, { "dec", " - 1" }
+};
+const std::map<std::string, std::string> g_unboxedCompares = {
+    { "gt", " > " }, { "lt", " < " }, { "eq", " == " },
+    { "gte", " >= " }, { "lte", " <= " }, { "ne", " != " }
+};
+
+const Token &subExprOf(const Token &expr) {
+    return expr.type == TokenType::Identifier ? expr : expr.children[0];
+}
+
+// Comparisons only when given a tuple literal, so its halves are used as is
+bool isUnboxedCall(const Token &funcCall, const types::TypeContext &ctx) {
+    if(!types::isStdCall(funcCall, ctx)) {
+        return false;
+    }
+    const auto &callee = funcCall.children[0].value;
+    return g_unboxedSteps.count(callee) > 0 || (
+        g_unboxedCompares.count(callee) > 0
+            && subExprOf(funcCall.children[2]).type == TokenType::TupDef
+    );
+}
+
+// In a tuple clone, fst and snd of the parameter are just its halves
+std::string unpackedHalf(
+        const Token &funcCall, const types::TypeContext &ctx) {
+    const auto &callee = funcCall.children[0].value;
+    const auto &arg = subExprOf(funcCall.children[2]);
+    if(ctx.tupleParam == "" || !types::isStdCall(funcCall, ctx)
+            || (callee != "fst" && callee != "snd")
+            || arg.type != TokenType::Identifier
+            || arg.value != ctx.tupleParam) {
+        return "";
+    }
+    return types::tupleHalfName(ctx.tupleParam, callee);
+}
+
+/*
+ * The same for equal literals, and for lists and tuples of nothing but
+ * literals, or "" for anything else. Strings are length prefixed so one
+ * can't look like the end of a list
+ */
+std::string literalKey(const Token &subExpr) {
+    switch(subExpr.type) {
+        case TokenType::String:
+            return "s" + std::to_string(subExpr.value.length()) + ":"
+                + subExpr.value;
+
+        case TokenType::Decimal:
+            return "d" + subExpr.value + ";";
+
+        case TokenType::Hex:
+            return "x" + subExpr.value + ";";
+
+        case TokenType::TupDef:
+        case TokenType::ListDef: {
+            const auto isTuple = subExpr.type == TokenType::TupDef;
+            std::string key = isTuple ? "{" : "[";
+            for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
+                const auto item = literalKey(subExprOf(subExpr.children[i]));
+                if(item == "") {
+                    return "";
+                }
+                key += item;
+            }
+            return key + (isTuple ? "}" : "]");
+        }
+
+        default:
+            return "";
+    }
+}
+
+// The constant a literal is kept in, if it is one
+std::string constantName(
+        const Token &subExpr, const types::TypeContext &types) {
+    if(types.constants->empty()) {
+        return "";
+    }
+    const auto constant = types.constants->find(literalKey(subExpr));
+    return constant == types.constants->end() ? "" : constant->second;
+}
+
+// Every distinct literal of a module, kept in prefix + its index
+struct ModuleConstants {
+    std::string prefix;
+    std::map<std::string, size_t> inds;
+    std::vector<const Token *> literals;
+
+    // Items come before the lists and tuples holding them
+    void collect(const Token &tok) {
+        for(const auto &child : tok.children) {
+            collect(child);
+        }
+        const auto key = literalKey(tok);
+        if(key != "" && inds.count(key) == 0) {
+            inds[key] = literals.size();
+            literals.push_back(&tok);
+        }
+    }
+
+    std::string name(const size_t ind) const {
+        return prefix + std::to_string(ind);
+    }
+
+    std::string itemName(const Token &item) const {
+        return name(inds.at(literalKey(subExprOf(item))));
+    }
+};
+
+ModuleConstants findConstants(const Token &program) {
+    ModuleConstants constants = {
+        inlining::letPrefix(program, "lit"), std::map<std::string, size_t>(),
+        std::vector<const Token *>()
+    };
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            constants.collect(topLevelTok.children[4]);
+        }
+    }
+    return constants;
+}
+
+// Marks each constant named in code (as a whole identifier)
+void markUsedConstants(
+        const std::string &code, const std::string &prefix,
+        std::vector<bool> &used) {
+    const auto isIdentChar = [](const char c) {
+        return isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+    for(auto at = code.find(prefix); at != std::string::npos;
+            at = code.find(prefix, at + 1)) {
+        if(at > 0 && isIdentChar(code[at - 1])) {
+            continue;
+        }
+        auto end = at + prefix.length();
+        size_t ind = 0;
+        while(end < code.length() && isdigit(code[end])) {
+            ind = ind * 10 + static_cast<size_t>(code[end] - '0');
+            end++;
+        }
+        if(end > at + prefix.length() && ind < used.size()
+                && (end == code.length() || !isIdentChar(code[end]))) {
+            used[ind] = true;
+        }
+    }
+}
+
+/*
+ * The module's constants, made once when the program starts rather than
+ * each time a literal is used, as each one's name and what it's made as.
+ * Only ones the bodies use (and the items of those) are made, as most
+ * number literals stay plain doubles
+ */
+std::vector<std::pair<std::string, std::string>> generateConstants(
+        const Token &program, const std::vector<std::string> &bodies) {
+    const auto constants = findConstants(program);
+    const auto &literals = constants.literals;
+    std::vector<bool> used(literals.size(), false);
+    for(const auto &body : bodies) {
+        markUsedConstants(body, constants.prefix, used);
+    }
+    for(size_t i = literals.size(); i-- > 0;) {
+        if(!used[i]) {
+            continue;
+        }
+        for(size_t j = 1; j + 1 < literals[i]->children.size(); j += 2) {
+            used[constants.inds.at(
+                literalKey(subExprOf(literals[i]->children[j]))
+            )] = true;
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> made;
+    for(size_t i = 0; i < literals.size(); i++) {
+        if(!used[i]) {
+            continue;
+        }
+        const auto &literal = *literals[i];
+        std::string code;
+        switch(literal.type) {
+            case TokenType::String:
+                code += "std::make_shared<StringVariable>(\"";
+                code += literal.value + "\")";
+                break;
+
+            case TokenType::Decimal:
+                code += "std::make_shared<NumberVariable>(";
+                code += literal.value + ")";
+                break;
+
+            case TokenType::Hex:
+                code += "std::make_shared<NumberVariable>(";
+                code += "static_cast<double>(0x" + literal.value + "))";
+                break;
+
+            case TokenType::TupDef:
+                code += "std::make_shared<TupleVariable>(";
+                code += "std::pair<VariablePointer, VariablePointer>(";
+                code += constants.itemName(literal.children[1]) + ", ";
+                code += constants.itemName(literal.children[3]) + "))";
+                break;
+
+            default:
+                code += "std::make_shared<ListVariable>(";
+                code += "std::vector<VariablePointer>({ ";
+                for(size_t j = 1; j + 1 < literal.children.size(); j += 2) {
+                    code += constants.itemName(literal.children[j]) + ", ";
+                }
+                code += "}))";
+                break;
+        }
+        made.push_back({ constants.name(i), code });
+    }
+    return made;
+}
+
+std::string generateConstantsCode(
+        const std::vector<std::pair<std::string, std::string>> &constants,
+        const std::string &storage) {
+    std::string code;
+    for(const auto &constant : constants) {
+        code += storage + "VariablePointer " + constant.first;
+        code += " = " + constant.second + ";\n";
+    }
+    return code;
+}
+
+/*
+ * Shards share their module's constants, so they get external linkage.
+ * Every module starts naming them from the same prefix, so they go in a
+ * namespace of the module's own to not clash when the modules are linked
+ */
+std::string constantsNamespace(
+        const Token &program, const ModuleInfo &modInfo) {
+    std::string start = "nabd_";
+    for(const auto c : modInfo.moduleName) {
+        start += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+    }
+    return inlining::letPrefix(program, start + "_lits");
+}
+
+std::string forwardDecl(const Token &funcDef) {
+    return "VariablePointer "
+        + (
+            funcDef.children[0].value == "main" ?
+                "fake_main" :
+                funcDef.children[0].value
+        ) + "(const VariablePointer &" + funcDef.children[2].value + ");\n";
+}
+
+std::string numberCloneDecl(const Token &funcDef) {
+    return "VariablePointer "
+        + types::numberCloneName(funcDef.children[0].value)
+        + "(const double " + funcDef.children[2].value + ");\n";
+}
+
+std::string tupleCloneParams(const std::string &param) {
+    return "const VariablePointer &" + types::tupleHalfName(param, "fst")
+        + ", const VariablePointer &" + types::tupleHalfName(param, "snd");
+}
+
+std::string tupleCloneDecl(const Token &funcDef) {
+    return "VariablePointer "
+        + types::tupleCloneName(funcDef.children[0].value)
+        + "(" + tupleCloneParams(funcDef.children[2].value) + ");\n";
+}
+
+bool isUnpackedMember(
+        const tailcalls::TailMember &member,
+        const types::TypeContext &types) {
+    return !member.isClone && types.tupleClones->count(member.name) > 0;
+}
+
+// Unpacked members take the second half of their parameter separately
+bool groupUnpacks(
+        const tailcalls::TailGroup &group, const types::TypeContext &types) {
+    for(const auto &member : group.members) {
+        if(isUnpackedMember(member, types)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string tailGroupDecl(
+        const tailcalls::TailGroup &group, const types::TypeContext &types,
+        const std::string &prefix) {
+    return "VariablePointer " + group.name + "(int " + prefix + "case, "
+        "VariablePointer " + prefix + "var, double " + prefix + "num"
+        + (
+            groupUnpacks(group, types) ?
+                ", VariablePointer " + prefix + "second)" : ")"
+        );
+}
+
+/*
+ * A tail group's member only starts the group's loop at its own case. An
+ * unpacked member's case starts from the halves of its parameter, so its
+ * generic entry takes the parameter apart first
+ */
+void generateTailEntryCode(
+        const Token &funcDef, const bool isClone, const bool isTupleClone,
+        const tailcalls::TailGroups &tail,
+        const std::pair<size_t, size_t> &member,
+        const types::TypeContext &types, std::string &out) {
+    const auto &param = funcDef.children[2].value;
+    const auto &group = tail.groups[member.first];
+    const auto &name = group.members[member.second].name;
+    out += "VariablePointer ";
+    if(isTupleClone) {
+        out += types::tupleCloneName(name) + "(" + tupleCloneParams(param);
+    } else {
+        out += name;
+        out += isClone ? "(const double " : "(const VariablePointer &";
+        out += param;
+    }
+    out += ") {\n    return ";
+    out += group.name;
+    out += "(" + std::to_string(member.second) + ", ";
+    if(isTupleClone) {
+        out += types::tupleHalfName(param, "fst") + ", 0, ";
+        out += types::tupleHalfName(param, "snd");
+    } else if(isUnpackedMember(group.members[member.second], types)) {
+        out += "fst(" + param + "), 0, snd(" + param + ")";
+    } else {
+        out += isClone ? "VariablePointer(), " + param : param + ", 0";
+        out += groupUnpacks(group, types) ? ", VariablePointer()" : "";
+    }
+    out += ");\n}";
+}
+
+/*
+ * The real main. With --stack, fake_main runs on a thread with a stack of
+ * that many megabytes, so deep (non-tail) recursion has room. The result
+ * is turned into the exit status there too, as freeing a deep one
+ * recurses as well
+ */
+std::string generateMainCode(const InputArguments &cliInputs) {
+    const std::string argVarsCode =
+        "  std::vector<VariablePointer> argVars;\n"
+        "  for(int i = 1; i < argc; i++) {\n"
+        "    argVars.push_back(\n"
+        "      std::make_shared<StringVariable>(\n"
+        "        std::string(args[i])\n"
+        "      )\n"
+        "    );\n"
+        "  }\n";
+    if(cliInputs.stackMegabytes == 0) {
+        return
+            "int main(int argc, char **args) {\n"
+            + argVarsCode +
+            "  const auto retVal = fake_main(\n"
+            "    std::make_shared<ListVariable>(argVars)\n"
+            "  );\n"
+            "  return static_cast<int>(\n"
+            "    std::dynamic_pointer_cast<NumberVariable>(\n"
+            "      retVal->toNumber()\n"
+            "    )->value\n"
+            "  );\n"
+            "}\n";
+    }
+    const auto stackBytes =
+        std::to_string(cliInputs.stackMegabytes) + "ull * 1024 * 1024";
+    return
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "#include <windows.h>\n"
+        "#else\n"
+        "#include <pthread.h>\n"
+        "#endif\n"
+        "struct FakeMainCall {\n"
+        "  VariablePointer args;\n"
+        "  int status;\n"
+        "};\n"
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "DWORD WINAPI fake_main_thread(LPVOID param) {\n"
+        "#else\n"
+        "void *fake_main_thread(void *param) {\n"
+        "#endif\n"
+        "  const auto call = static_cast<FakeMainCall *>(param);\n"
+        "  call->status = static_cast<int>(\n"
+        "    std::dynamic_pointer_cast<NumberVariable>(\n"
+        "      fake_main(call->args)->toNumber()\n"
+        "    )->value\n"
+        "  );\n"
+        "  return 0;\n"
+        "}\n"
+        "int main(int argc, char **args) {\n"
+        + argVarsCode +
+        "  FakeMainCall call = {\n"
+        "    std::make_shared<ListVariable>(argVars), 1\n"
+        "  };\n"
+        "#if defined(_WIN32) || defined(WIN32)\n"
+        "  const auto thread = CreateThread(\n"
+        "    NULL, " + stackBytes + ", fake_main_thread, &call,\n"
+        "    STACK_SIZE_PARAM_IS_A_RESERVATION, NULL\n"
+        "  );\n"
+        "  if(thread != NULL) {\n"
+        "    WaitForSingleObject(thread, INFINITE);\n"
+        "    CloseHandle(thread);\n"
+        "  }\n"
+        "#else\n"
+        "  pthread_attr_t attr;\n"
+        "  pthread_t thread;\n"
+        "  pthread_attr_init(&attr);\n"
+        "  pthread_attr_setstacksize(&attr, " + stackBytes + ");\n"
+        "  if(pthread_create(&thread, &attr, fake_main_thread, &call) == 0) {\n"
+        "    pthread_join(thread, NULL);\n"
+        "  }\n"
+        "  pthread_attr_destroy(&attr);\n"
+        "#endif\n"
+        "  return call.status;\n"
+        "}\n";
+}
+
+// Whether expr calls one of callees anywhere but as one of tailCalls
+bool callsOutsideTail(
+        const Token &expr, const std::set<std::string> &callees,
+        const std::set<const Token *> &tailCalls) {
+    if(expr.type == TokenType::FuncCall
+            && callees.count(expr.children[0].value) > 0
+            && tailCalls.count(&expr) == 0) {
+        return true;
+    }
+    for(const auto &child : expr.children) {
+        if(callsOutsideTail(child, callees, tailCalls)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * With --memoize, the pure functions that call themselves (or each other)
+ * other than as a loop. Those are the ones that can take exponential time
+ * working out the same results again, like a naive Fibonacci. A function
+ * whose recursive calls are all tail calls is left to loop instead
+ */
+std::set<std::string> findMemoizedFuncs(
+        const Token &program, const InputArguments &cliInputs,
+        const types::TypeContext &types) {
+    std::set<std::string> memoized;
+    if(cliInputs.memoEntries == 0) {
+        return memoized;
+    }
+    const auto pureFuncs = folding::findPureFuncs(program, types);
+    std::vector<std::string> names;
+    std::map<std::string, size_t> inds;
+    for(const auto &func : pureFuncs) {
+        inds[func.first] = names.size();
+        names.push_back(func.first);
+    }
+    std::vector<std::vector<size_t>> edges(names.size());
+    for(size_t i = 0; i < names.size(); i++) {
+        const auto &body = pureFuncs.at(names[i])->children[4];
+        for(const auto &callee : deadcode::calledNames(body)) {
+            if(inds.count(callee) > 0) {
+                edges[i].push_back(inds.at(callee));
+            }
+        }
+    }
+    for(const auto &component : tailcalls::stronglyConnected(edges)) {
+        std::set<std::string> componentNames;
+        for(const auto func : component) {
+            componentNames.insert(names[func]);
+        }
+        for(const auto func : component) {
+            const auto &body = pureFuncs.at(names[func])->children[4];
+            if(callsOutsideTail(
+                    body, componentNames,
+                    tailcalls::tailCallsIn(body, types))) {
+                memoized.insert(names[func]);
+            }
+        }
+    }
+    return memoized;
+}
+
+// The module's types, plus the functions --memoize caches
+types::TypeContext codeGenTypes(
+        const Token &program, const InputArguments &cliInputs) {
+    auto types = types::moduleTypeContext(program, cliInputs);
+    types.memoized = std::make_shared<const std::set<std::string>>(
+        findMemoizedFuncs(program, cliInputs, types)
+    );
+    return types;
+}
+
+/*
+ * The implementation of every function (plus the real main), in order.
+ * Each body only depends on its own definition, so they're generated on
+ * several threads for big modules
+ */
+std::vector<std::string> generateFuncBodies(
+        const Token &program, const InputArguments &cliInputs,
+        const types::TypeContext &moduleTypes) {
+    std::vector<const Token *> funcDefs;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            funcDefs.push_back(&topLevelTok);
+        }
+    }
+
+    // Each tail group's loop goes after the function of its first member
+    const auto tail = tailcalls::findTailGroups(program, moduleTypes);
+    auto types = moduleTypes;
+    const auto constants = findConstants(program);
+    std::map<std::string, std::string> constantNames;
+    for(const auto &constant : constants.inds) {
+        constantNames[constant.first] = constants.name(constant.second);
+    }
+    types.constants =
+        std::make_shared<const std::map<std::string, std::string>>(
+            constantNames
+        );
+    std::map<const Token *, std::vector<size_t>> groupsAfter;
+    for(size_t i = 0; i < tail.groups.size(); i++) {
+        groupsAfter[tail.groups[i].members[0].funcDef].push_back(i);
+    }
+
+    std::vector<std::string> bodies(funcDefs.size());
+    parallelFor(funcDefs.size(), [&](const size_t i) {
+        const auto &funcDef = *funcDefs[i];
+        const auto &funcName = funcDef.children[0].value;
+        auto &body = bodies[i];
+        const auto member = tail.byName.find(funcName);
+        if(member != tail.byName.end()) {
+            generateTailEntryCode(
+                funcDef, false, false, tail, member->second, types, body
+            );
+        } else {
+            codegen::generateFuncDefCode(funcDef, cliInputs, types, body);
+        }
+        body += "\n";
+        if(types.numberClones->count(funcName) > 0) {
+            const auto clone = tail.byName.find(
+                types::numberCloneName(funcName)
+            );
+            if(clone != tail.byName.end()) {
+                generateTailEntryCode(
+                    funcDef, true, false, tail, clone->second, types, body
+                );
+            } else {
+                codegen::generateNumberCloneCode(
+                    funcDef, cliInputs, types, body
+                );
+            }
+            body += "\n";
+        }
+        if(types.tupleClones->count(funcName) > 0) {
+            if(member != tail.byName.end()) {
+                generateTailEntryCode(
+                    funcDef, false, true, tail, member->second, types, body
+                );
+            } else {
+                codegen::generateTupleCloneCode(
+                    funcDef, cliInputs, types, body
+                );
+            }
+            body += "\n";
+        }
+        const auto groups = groupsAfter.find(&funcDef);
+        if(groups != groupsAfter.end()) {
+            for(const auto group : groups->second) {
+                codegen::generateTailGroupCode(tail, group, types, body);
+                body += "\n";
+            }
+        }
+        if(funcDef.children[0].value == "main") {
+            body += generateMainCode(cliInputs);
+        }
+    }, g_codeGenMinDefsPerThread);
+    return bodies;
+}
+
+size_t chooseShardCount(const std::vector<std::string> &bodies) {
+    size_t codeSize = 0;
+    for(const auto &body : bodies) {
+        codeSize += body.length();
+    }
+    const auto bySize =
+        (codeSize + g_shardTargetBytes - 1) / g_shardTargetBytes;
+    const auto byDefs = bodies.size() / g_shardMinDefs;
+    return std::max<size_t>(1, std::min({ bySize, byDefs, g_maxShards }));
+}
+
+/*
+ * Small functions are inlined and constants folded before anything else,
+ * so the types (and which functions get clones) are worked out on the code
+ * that's generated. Values that are thrown away become plain sequences and
+ * repeated pure calls are bound once. The C backend is for quick builds,
+ * so it keeps calls and containers as written.
+ * Whatever main no longer reaches after that isn't generated at all
+ */
+Token foldedProgram(const Token &program, const InputArguments &cliInputs) {
+    const auto ctx = types::moduleTypeContext(program, cliInputs);
+    if(cliInputs.cBackend) {
+        return deadcode::dropUnreachable(
+            folding::foldConstants(program, ctx)
+        );
+    }
+    const auto folded = folding::foldConstants(
+        inlining::inlineCalls(program, ctx, cliInputs), ctx
+    );
+    return deadcode::dropUnreachable(cse::eliminateCommonSubexprs(
+        sequencing::lowerDiscarded(folded, ctx), ctx
+    ));
+}
+
+std::string codegen::shardName(
+        const ModuleInfo &modInfo,
+        const size_t shard, const size_t shardCount) {
+    return shardCount > 1 ?
+        modInfo.moduleName + "_shard" + std::to_string(shard) :
+        modInfo.moduleName;
+}
+
+std::string codegen::declarationsName(const ModuleInfo &modInfo) {
+    return modInfo.moduleName + "_decls.hpp";
+}
+
+std::string codegen::sourceExtension(const InputArguments &cliInputs) {
+    return cliInputs.cBackend ? ".c" : ".cpp";
+}
+
 std::string codegen::generateCppCode(
         const Token &program,
         const InputArguments &cliInputs,
         const ModuleInfo &modInfo) {
+    return generateModuleCode(program, cliInputs, modInfo, 1).shards[0];
+}
+
+codegen::ModuleCode splitIntoShards(
+    const Token &program,
+    const InputArguments &cliInputs,
+    const ModuleInfo &modInfo,
+    const types::TypeContext &types,
+    const std::vector<std::string> &bodies, const size_t shardCount
+);
+
+codegen::ModuleCode codegen::generateModuleCode(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo) {
+    const auto folded = foldedProgram(program, cliInputs);
+    if(cliInputs.cBackend) {
+        return generateCModuleCode(folded, cliInputs, modInfo);
+    }
+    const auto types = codeGenTypes(folded, cliInputs);
+    const auto bodies = generateFuncBodies(folded, cliInputs, types);
+    return splitIntoShards(
+        folded, cliInputs, modInfo, types, bodies, chooseShardCount(bodies)
+    );
+}
+
+codegen::ModuleCode codegen::generateModuleCode(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo,
+        const size_t shardCount) {
+    const auto folded = foldedProgram(program, cliInputs);
+    if(cliInputs.cBackend) {
+        return generateCModuleCode(folded, cliInputs, modInfo);
+    }
+    const auto types = codeGenTypes(folded, cliInputs);
+    return splitIntoShards(
+        folded, cliInputs, modInfo, types,
+        generateFuncBodies(folded, cliInputs, types), shardCount
+    );
+}
+
+codegen::ModuleCode splitIntoShards(
+        const Token &program,
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo,
+        const types::TypeContext &types,
+        const std::vector<std::string> &bodies, const size_t shardCount) {
     if(!dirExists(modInfo.buildFolder)) {
-        std::cout
+        logOut()
             << "Build folder '" << modInfo.buildFolder
             << "' does not exist. Creating!" << std::endl;
     }
     createDirectory(modInfo.buildFolder);
 
-    std::stringstream cppCode;
-    cppCode << "#include <Variable.hpp>\n";
-
     // Add includes and header definitions
+    std::stringstream declarations;
+    declarations << "#include <Variable.hpp>\n";
+    const auto called = deadcode::calledNames(program);
     for(const auto &topLevelTok : program.children) {
         switch(topLevelTok.type) {
             case TokenType::FuncDef:
-                cppCode
-                    << "VariablePointer "
-                    << (
-                        topLevelTok.children[0].value == "main" ?
-                            "fake_main" :
-                            topLevelTok.children[0].value
-                    ) << "(const VariablePointer &"
-                    << topLevelTok.children[2].value
-                    << ");\n";
+                declarations << forwardDecl(topLevelTok);
+                if(types.numberClones->count(topLevelTok.children[0].value)) {
+                    declarations << numberCloneDecl(topLevelTok);
+                }
+                if(types.tupleClones->count(topLevelTok.children[0].value)) {
+                    declarations << tupleCloneDecl(topLevelTok);
+                }
                 break;
             
             case TokenType::Include:
-                cppCode
-                    << generateIncludeCode(topLevelTok, cliInputs, modInfo)
+                declarations
+                    << codegen::generateIncludeCode(
+                        topLevelTok, called, cliInputs, modInfo
+                    )
                     << "\n";
                 break;
             
@@ -54,83 +757,88 @@ std::string codegen::generateCppCode(
         }
     }
 
+    const auto constants = generateConstants(program, bodies);
+    const auto constantsSpace = constantsNamespace(program, modInfo);
+    if(shardCount <= 1) {
+        declarations << generateConstantsCode(constants, "static const ");
+    } else if(constants.size() > 0) {
+        declarations << "namespace " << constantsSpace << " {\n";
+        for(const auto &constant : constants) {
+            declarations
+                << "extern const VariablePointer " << constant.first << ";\n";
+        }
+        declarations
+            << "}\nusing namespace " << constantsSpace << ";\n";
+    }
+    const auto tail = tailcalls::findTailGroups(program, types);
+    for(const auto &group : tail.groups) {
+        declarations << tailGroupDecl(group, types, "t") << ";\n";
+        if(group.steps.size() > 0) {
+            logOut() << "Looping over the recursion in";
+            for(const auto &member : group.members) {
+                logOut() << " '" << member.name << "'";
+            }
+            logOut() << ", keeping count of its steps" << std::endl;
+        }
+    }
+
     // Actually implement the functions
-    for(const auto &topLevelTok : program.children) {
-        switch(topLevelTok.type) {
-            case TokenType::FuncDef:
-                cppCode << generateFuncDefCode(topLevelTok) << "\n";
-                if(topLevelTok.children[0].value == "main") {
-                    cppCode
-                        << "int main(int argc, char **args) {\n"
-                        << "  std::vector<VariablePointer> argVars;\n"
-                        << "  for(int i = 1; i < argc; i++) {\n"
-                        << "    argVars.push_back(\n"
-                        << "      std::make_shared<StringVariable>(\n"
-                        << "        std::string(args[i])\n"
-                        << "      )\n"
-                        << "    );\n"
-                        << "  }\n"
-                        << "  const auto retVal = fake_main(\n"
-                        << "    std::make_shared<ListVariable>(argVars)\n"
-                        << "  );\n"
-                        << "  return static_cast<int>(\n"
-                        << "    std::dynamic_pointer_cast<NumberVariable>(\n"
-                        << "      retVal->toNumber()\n"
-                        << "    )->value\n"
-                        << "  );\n"
-                        << "}\n";
-                }
-                break;
-            
-            default:
-                break;
+    codegen::ModuleCode code;
+    if(shardCount <= 1) {
+        std::stringstream cppCode;
+        cppCode << declarations.str();
+        for(const auto &body : bodies) {
+            cppCode << body;
         }
+        code.shards.push_back(cppCode.str());
+        return code;
     }
 
-    return cppCode.str();
+    /*
+     * Split the bodies into runs of about the same amount of code, so that
+     * each shard takes g++ about as long as the others
+     */
+    code.declarations = "#pragma once\n" + declarations.str();
+    size_t codeSize = 0;
+    for(const auto &body : bodies) {
+        codeSize += body.length();
+    }
+    size_t bodyInd = 0, doneSize = 0;
+    for(size_t shard = 0; shard < shardCount; shard++) {
+        const auto shardEnd = codeSize * (shard + 1) / shardCount;
+        std::stringstream cppCode;
+        cppCode
+            << "#include \"" << codegen::declarationsName(modInfo) << "\"\n";
+        if(shard == 0 && constants.size() > 0) {
+            cppCode
+                << "namespace " << constantsSpace << " {\n"
+                << generateConstantsCode(constants, "const ") << "}\n";
+        }
+        while(bodyInd < bodies.size()
+                && (doneSize < shardEnd || shard + 1 == shardCount)) {
+            cppCode << bodies[bodyInd];
+            doneSize += bodies[bodyInd].length();
+            bodyInd++;
+        }
+        code.shards.push_back(cppCode.str());
+    }
+    return code;
 }
 
 std::string codegen::generateIncludeCode(
-        const Token &include,
+        const Token &include, const std::set<std::string> &called,
         const InputArguments &cliInputs,
         const ModuleInfo &modInfo) {
     const auto ident = include.children[1].value; // $ <ident> $ -> <ident>
 
     // Get the real file name corresponding to the modul name
-    std::string fileName = "";
-    bool isCpp = false;
-    for(const auto &folder : cliInputs.includeFolders) {
-        std::cout
-            << "Checking for module '" << ident << "' in folder '"
-            << folder << '\'' << std::endl;
-
-        // Check for C++ code
-        const auto hppFileName =
-            (folder != "" ? (folder + "/") : "") + ident + ".hpp";
-        std::cout << "Checking for '" << hppFileName << "'..." << std::endl;
-        std::ifstream hppFile(hppFileName);
-        if(hppFile.is_open()) {
-            hppFile.close();
-            fileName = hppFileName;
-            isCpp = true;
-            break;
-        }
-
-        // Check for nabd code
-        const auto nabdFileName =
-            (folder != "" ? (folder + "/") : "") + ident + ".nabd";
-        std::cout << "Checking for '" << nabdFileName << "'..." << std::endl;
-        std::ifstream moduleFile(nabdFileName);
-        if(moduleFile.is_open()) {
-            moduleFile.close();
-            fileName = nabdFileName;
-            isCpp = false;
-            break;
-        }
-    }
-
-    if(fileName == "") {
-        errorOut("Can't find included module '" + ident + "'!");
+    ModuleLocation location;
+    try {
+        location = findModule(ident, cliInputs);
+    } catch(CompileError &e) {
+        e.line = include.children[1].line;
+        e.col = include.children[1].col;
+        throw;
     }
 
     /*
@@ -138,8 +846,10 @@ std::string codegen::generateIncludeCode(
      * But if it's not, we need to open the file and generate a header
      * in the module folder
      */
-    if(!isCpp) {
-        generateHeaderFile(fileName, ident, cliInputs, modInfo);
+    if(!location.isCpp) {
+        generateHeaderFile(
+            location.fileName, ident, called, cliInputs, modInfo
+        );
     } else {
 
     }
@@ -150,28 +860,31 @@ std::string codegen::generateIncludeCode(
 // This assumes a file is known to exist and is a .nabd file
 void codegen::generateHeaderFile(
         const std::string &moduleFile, const std::string &newFileNameBase,
+        const std::set<std::string> &called,
         const InputArguments &cliInputs,
         const ModuleInfo &modInfo) {
     // We have to parse so we can extract function definitions
-    const auto code = readFile(moduleFile);
-    const auto prog = parser::parseProgram(code, 0, 1, 1).result;
+    const auto prog = loadModule(moduleFile);
 
-    // Extract function definitions & store in header file code
+    /*
+     * Extract function definitions & store in header file code. Modules
+     * including this one may have inlined some of it, so the hash makes
+     * the header (and so them) change whenever those bodies do
+     */
     std::stringstream headerCode;
-    headerCode << "#pragma once\n#include <Variable.hpp>\n";
-    for(const auto &topLevelTok : prog.children) {
+    headerCode
+        << "#pragma once\n#include <Variable.hpp>\n"
+        << "// Inline interface hash: "
+        << inlining::interfaceHash(inlining::exportedInlines(
+            *prog, cliInputs, cliInputs.importInlineSize
+        )) << "\n";
+    for(const auto &topLevelTok : prog->children) {
         switch(topLevelTok.type) {
             case TokenType::FuncDef:
-                // ident = ident > ...
-                headerCode
-                    << "VariablePointer "
-                    << (
-                        topLevelTok.children[0].value == "main" ?
-                            "fake_main" :
-                            topLevelTok.children[0].value
-                    ) << "(const VariablePointer &"
-                    << topLevelTok.children[2].value
-                    << ");\n";
+                // ident = ident > ..., if the including module calls it
+                if(called.count(topLevelTok.children[0].value) > 0) {
+                    headerCode << forwardDecl(topLevelTok);
+                }
                 break;
             
             default:
@@ -182,85 +895,885 @@ void codegen::generateHeaderFile(
 
     // Save the header code
     const auto fileName = modInfo.buildFolder + "/" + newFileNameBase + ".hpp";
-    std::ofstream headerFile(fileName);
-    if(!headerFile.is_open()) {
+    if(!writeFileIfChanged(fileName, headerCode.str())) {
         errorOut(
             "Failed to create header file for included module '"
                 + newFileNameBase + "'!"
         );
     }
-    headerFile << headerCode.str();
-    headerFile.close();
 }
 
-std::string codegen::generateFuncDefCode(const Token &funcDef) {
-    auto funcName = funcDef.children[0].value;
-    if(funcName == "main") {
-        funcName = "fake_main";
+// The statements of a function, ending in returning its result
+void generateFuncStatements(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    if(cliInputs.anf
+            || codegen::exprDepth(funcDef.children[4]) > g_anfMinDepth) {
+        codegen::generateAnfCode(funcDef, types, out);
+    } else {
+        out += "    return ";
+        codegen::generateExprCode(funcDef.children[4], types, out);
+        out += ";\n";
     }
-    const auto funcParamName = funcDef.children[2].value;
-    const auto exprCode = generateExprCode(funcDef.children[4]);
+}
+
+/*
+ * Looks the argument up in the function's MemoTable (see Variable.hpp)
+ * before working the result out, and keeps the result there. Number and
+ * tuple clones box their argument to look it up
+ */
+void generateMemoizedStatements(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    const auto &funcName = funcDef.children[0].value;
+    const auto &param = funcDef.children[2].value;
+    auto name = funcName;
+    if(types.numberParam != "") {
+        name = types::numberCloneName(funcName);
+    } else if(types.tupleParam != "") {
+        name = types::tupleCloneName(funcName);
+    }
+    const auto key = name == funcName ? param : name + "__key";
+    out += "    static MemoTable " + name + "__memo(\"" + name + "\", ";
+    out += std::to_string(cliInputs.memoEntries) + ");\n";
+    if(types.numberParam != "") {
+        out += "    const VariablePointer " + key;
+        out += " = std::make_shared<NumberVariable>(" + param + ");\n";
+    } else if(types.tupleParam != "") {
+        out += "    const VariablePointer " + key;
+        out += " = std::make_shared<TupleVariable>(";
+        out += "std::pair<VariablePointer, VariablePointer>(";
+        out += types::tupleHalfName(param, "fst") + ", ";
+        out += types::tupleHalfName(param, "snd") + "));\n";
+    }
+    out += "    VariablePointer " + name + "__result;\n";
+    out += "    if(" + name + "__memo.find(" + key + ", " + name;
+    out += "__result)) {\n        return " + name + "__result;\n    }\n";
+    out += "    " + name + "__result = [&]() -> VariablePointer {\n";
+    generateFuncStatements(funcDef, cliInputs, types, out);
+    out += "    }();\n";
+    out += "    " + name + "__memo.insert(" + key + ", ";
+    out += name + "__result);\n";
+    out += "    return " + name + "__result;\n";
+}
+
+// Everything after the parameter list
+void generateFuncBody(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    out += ") {\n";
+    if(types.memoized->count(funcDef.children[0].value) > 0) {
+        generateMemoizedStatements(funcDef, cliInputs, types, out);
+    } else {
+        generateFuncStatements(funcDef, cliInputs, types, out);
+    }
+    out += "}";
+}
+
+void codegen::generateFuncDefCode(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    const auto &funcName = funcDef.children[0].value;
+    out += "VariablePointer ";
+    out += funcName == "main" ? "fake_main" : funcName;
+    out += "(const VariablePointer &";
+    out += funcDef.children[2].value;
+    generateFuncBody(funcDef, cliInputs, types, out);
+}
+
+void codegen::generateNumberCloneCode(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    auto cloneTypes = types;
+    cloneTypes.numberParam = funcDef.children[2].value;
+    out += "VariablePointer ";
+    out += types::numberCloneName(funcDef.children[0].value);
+    out += "(const double ";
+    out += funcDef.children[2].value;
+    generateFuncBody(funcDef, cliInputs, cloneTypes, out);
+}
 
-    return "VariablePointer " + funcName
-        + "(const VariablePointer &" + funcParamName
-        + ") {\n    return " + exprCode + ";\n}";
+void codegen::generateTupleCloneCode(
+        const Token &funcDef, const InputArguments &cliInputs,
+        const types::TypeContext &types, std::string &out) {
+    auto cloneTypes = types;
+    cloneTypes.tupleParam = funcDef.children[2].value;
+    out += "VariablePointer ";
+    out += types::tupleCloneName(funcDef.children[0].value);
+    out += "(" + tupleCloneParams(funcDef.children[2].value);
+    generateFuncBody(funcDef, cliInputs, cloneTypes, out);
 }
 
-std::string codegen::generateExprCode(const Token &expr) {
-    const auto subExpr =
+size_t codegen::exprDepth(const Token &expr) {
+    const auto &subExpr =
         expr.type == TokenType::Identifier ?
             expr :
             expr.children[0];
+    size_t depth = 0;
+    for(const auto &child : subExpr.children) {
+        if(child.type == TokenType::Expr
+                || child.type == TokenType::Identifier) {
+            depth = std::max(depth, exprDepth(child));
+        }
+    }
+    return depth + 1;
+}
+
+/*
+ * Lowering to A-normal form. Every call, tuple and list gets its own
+ * `const VariablePointer tN = ...;` so what g++ sees per statement stays
+ * small, and sub-expressions are evaluated left to right in the order
+ * they're written (C++ leaves argument order unspecified otherwise).
+ * Ternaries become if/else so only the branch taken gets evaluated
+ */
+struct AnfLowering {
+    std::string &out;
+    const types::TypeContext &types;
+    std::string tempPrefix;
+    size_t nextTemp;
+
+    // Tail calls within this group jump to their case (see TailCalls.hpp)
+    const tailcalls::TailGroups *tail;
+    size_t groupInd;
+
+    /*
+     * Whether the group builds lists or tuples around its tail calls. If
+     * so, results go where tempPrefix + "dest" points, in what's been
+     * built so far, and tempPrefix + "result" (the first) is returned
+     */
+    bool cons;
+
+    void indent(const size_t depth) {
+        out.append(depth * 4, ' ');
+    }
+
+    // Names, literals, and anything else that's fine to repeat as is
+    static bool isAtom(const Token &subExpr) {
+        return subExpr.type == TokenType::Identifier
+            || subExpr.type == TokenType::String
+            || subExpr.type == TokenType::Decimal
+            || subExpr.type == TokenType::Hex;
+    }
+
+    // Emits whatever a value needs first and returns code to refer to it
+    std::string atom(const Token &expr, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Let) {
+            bind(subExpr, depth);
+            return atom(subExpr.children[2], depth);
+        }
+        if(isAtom(subExpr) || constantName(subExpr, types) != "") {
+            std::string code;
+            codegen::generateExprCode(expr, types, code);
+            return code;
+        }
+
+        if(subExpr.type == TokenType::Ternary) {
+            const auto name = tempPrefix + std::to_string(nextTemp++);
+            indent(depth);
+            out += "VariablePointer " + name + ";\n";
+            branch(subExpr, name, depth);
+            return name;
+        }
+
+        const auto code = value(expr, depth);
+        const auto name = tempPrefix + std::to_string(nextTemp++);
+        indent(depth);
+        out += "const VariablePointer " + name + " = " + code + ";\n";
+        return name;
+    }
+
+    // A double holding expr's value as a number, as generateNumberCode does
+    std::string number(const Token &expr, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Let) {
+            bind(subExpr, depth);
+            return number(subExpr.children[2], depth);
+        }
+        if(subExpr.type == TokenType::Decimal
+                || subExpr.type == TokenType::Hex
+                || (subExpr.type == TokenType::Identifier
+                    && subExpr.value == types.numberParam)) {
+            std::string code;
+            codegen::generateNumberCode(expr, types, code);
+            return code;
+        }
+        if(subExpr.type == TokenType::FuncCall
+                && isUnboxedCall(subExpr, types)) {
+            const auto code = unboxedCall(subExpr, depth);
+            const auto name = tempPrefix + std::to_string(nextTemp++);
+            indent(depth);
+            out += "const double " + name + " = " + code + ";\n";
+            return name;
+        }
+
+        const auto boxed = atom(expr, depth);
+        if(types::inferType(expr, types) == types::ExprType::Number) {
+            return "std::static_pointer_cast<NumberVariable>(" + boxed
+                + ")->value";
+        }
+        return "numberValue(" + boxed + ")";
+    }
+
+    std::string unboxedCall(const Token &funcCall, const size_t depth) {
+        const auto &callee = funcCall.children[0].value;
+        const auto step = g_unboxedSteps.find(callee);
+        if(step != g_unboxedSteps.end()) {
+            return "(" + number(funcCall.children[2], depth) + step->second
+                + ")";
+        }
+        const auto &tuple = unwrap(funcCall.children[2]);
+        const auto first = number(tuple.children[1], depth);
+        const auto second = number(tuple.children[3], depth);
+        return "(" + first + g_unboxedCompares.at(callee) + second
+            + " ? 1.0 : -1.0)";
+    }
+
+    // The value of a non-ternary expression with its parts already emitted
+    std::string value(const Token &expr, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        const auto constant = constantName(subExpr, types);
+        if(constant != "") {
+            return constant;
+        }
+        switch(subExpr.type) {
+            case TokenType::Let:
+                bind(subExpr, depth);
+                return value(subExpr.children[2], depth);
+
+            case TokenType::FuncCall:
+                if(isUnboxedCall(subExpr, types)) {
+                    return "std::make_shared<NumberVariable>("
+                        + unboxedCall(subExpr, depth) + ")";
+                }
+                if(types::callsNumberClone(subExpr, types)) {
+                    return types::numberCloneName(subExpr.children[0].value)
+                        + "(" + number(subExpr.children[2], depth) + ")";
+                }
+                if(types::callsTupleClone(subExpr, types)) {
+                    const auto &tuple = unwrap(subExpr.children[2]);
+                    const auto first = atom(tuple.children[1], depth);
+                    const auto second = atom(tuple.children[3], depth);
+                    return types::tupleCloneName(subExpr.children[0].value)
+                        + "(" + first + ", " + second + ")";
+                }
+                if(unpackedHalf(subExpr, types) != "") {
+                    return unpackedHalf(subExpr, types);
+                }
+                return subExpr.children[0].value + "("
+                    + atom(subExpr.children[2], depth) + ")";
+
+            case TokenType::TupDef: {
+                const auto first = atom(subExpr.children[1], depth);
+                const auto second = atom(subExpr.children[3], depth);
+                return "std::make_shared<TupleVariable>("
+                    "std::pair<VariablePointer, VariablePointer>("
+                    + first + ", " + second + "))";
+            }
+
+            case TokenType::ListDef: {
+                std::string elems;
+                for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
+                    elems += atom(subExpr.children[i], depth) + ", ";
+                }
+                return "std::make_shared<ListVariable>("
+                    "std::vector<VariablePointer>({ " + elems + "}))";
+            }
+
+            default: {
+                std::string code;
+                codegen::generateExprCode(expr, types, code);
+                return code;
+            }
+        }
+    }
+
+    // Sends a value to dest, or returns it from the function if dest is ""
+    void store(const Token &expr, const std::string &dest, const size_t depth) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Ternary) {
+            branch(subExpr, dest, depth);
+            return;
+        }
+        if(subExpr.type == TokenType::Let) {
+            bind(subExpr, depth);
+            store(subExpr.children[2], dest, depth);
+            return;
+        }
+        if(dest == "" && subExpr.type == TokenType::FuncCall
+                && (stepJump(subExpr, depth) || tailJump(subExpr, depth))) {
+            return;
+        }
+        if(dest == "" && (
+                subExpr.type == TokenType::ListDef
+                    || subExpr.type == TokenType::TupDef
+                ) && endsInGroupCall(expr)) {
+            consCell(subExpr, depth);
+            return;
+        }
+        const auto code = value(expr, depth);
+        indent(depth);
+        if(dest == "" && cons) {
+            out += "*" + tempPrefix + "dest = " + code + ";\n";
+            indent(depth);
+            out += "return " + tempPrefix + "result;\n";
+            return;
+        }
+        if(dest == "" && hasSteps()) {
+            out += "return " + tempPrefix + "steps(" + code + ");\n";
+            return;
+        }
+        out += (dest == "" ? "return " : dest + " = ") + code + ";\n";
+    }
+
+    bool hasSteps(void) const {
+        return tail != nullptr && tail->groups[groupInd].steps.size() > 0;
+    }
+
+    /*
+     * A tail call with the group's steps around it. They're counted, and
+     * done on the result once there is one
+     */
+    bool stepJump(const Token &funcCall, const size_t depth) {
+        if(!hasSteps()) {
+            return false;
+        }
+        std::vector<std::string> steps;
+        const auto call = tailcalls::stepsAround(funcCall, types, steps);
+        if(call == nullptr || steps != tail->groups[groupInd].steps) {
+            return false;
+        }
+        indent(depth);
+        out += tempPrefix + "pending++;\n";
+        return tailJump(*call, depth);
+    }
+
+    // A temporary made by the inliner
+    void bind(const Token &let, const size_t depth) {
+        const auto code = unwrap(let.children[1]).type == TokenType::Ternary ?
+            atom(let.children[1], depth) : value(let.children[1], depth);
+        indent(depth);
+        out += "[[maybe_unused]] const VariablePointer "
+            + let.children[0].value + " = " + code + ";\n";
+    }
+
+    // Whether a tail call within the group is the last thing expr does
+    bool endsInGroupCall(const Token &expr) {
+        const auto &subExpr = unwrap(expr);
+        switch(subExpr.type) {
+            case TokenType::Ternary:
+                return endsInGroupCall(subExpr.children[3])
+                    || endsInGroupCall(subExpr.children[5]);
+
+            case TokenType::Let:
+                return endsInGroupCall(subExpr.children[2]);
+
+            case TokenType::ListDef:
+            case TokenType::TupDef:
+                return endsInGroupCall(
+                    subExpr.children[subExpr.children.size() - 2]
+                );
+
+            case TokenType::FuncCall: {
+                if(tail == nullptr) {
+                    return false;
+                }
+                const auto callee = tail->byName.find(
+                    tailcalls::calleeName(subExpr, types)
+                );
+                return callee != tail->byName.end()
+                    && callee->second.first == groupInd;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    // Whether expr (in tail position) puts a tail call in a list or tuple
+    bool buildsCons(const Token &expr) {
+        const auto &subExpr = unwrap(expr);
+        if(subExpr.type == TokenType::Ternary) {
+            return buildsCons(subExpr.children[3])
+                || buildsCons(subExpr.children[5]);
+        } else if(subExpr.type == TokenType::Let) {
+            return buildsCons(subExpr.children[2]);
+        }
+        return (
+            subExpr.type == TokenType::ListDef
+                || subExpr.type == TokenType::TupDef
+        ) && endsInGroupCall(expr);
+    }
+
+    /*
+     * Makes the list or tuple with a gap for its last part, which the rest
+     * of the loop then fills in
+     */
+    void consCell(const Token &subExpr, const size_t depth) {
+        const auto last = subExpr.children.size() - 2;
+        const auto name = tempPrefix + std::to_string(nextTemp++);
+        std::string code, gap;
+        if(subExpr.type == TokenType::TupDef) {
+            code = "std::make_shared<TupleVariable>("
+                "std::pair<VariablePointer, VariablePointer>("
+                + atom(subExpr.children[1], depth) + ", nullptr))";
+            gap = "&" + name + "->values.second";
+        } else {
+            std::string elems;
+            for(size_t i = 1; i < last; i += 2) {
+                elems += atom(subExpr.children[i], depth) + ", ";
+            }
+            code = "std::make_shared<ListVariable>("
+                "std::vector<VariablePointer>({ " + elems + "nullptr }))";
+            gap = "&" + name + "->values.back()";
+        }
+        indent(depth);
+        out += "const auto " + name + " = " + code + ";\n";
+        indent(depth);
+        out += "*" + tempPrefix + "dest = " + name + ";\n";
+        indent(depth);
+        out += tempPrefix + "dest = " + gap + ";\n";
+        store(subExpr.children[last], "", depth);
+    }
+
+    // Hands the argument over and goes round the loop instead of calling
+    bool tailJump(const Token &funcCall, const size_t depth) {
+        if(tail == nullptr) {
+            return false;
+        }
+        const auto callee = tail->byName.find(
+            tailcalls::calleeName(funcCall, types)
+        );
+        if(callee == tail->byName.end() || callee->second.first != groupInd) {
+            return false;
+        }
+        const auto caseInd = callee->second.second;
+        const auto &member = tail->groups[groupInd].members[caseInd];
+        if(isUnpackedMember(member, types)) {
+            unpackedJump(funcCall.children[2], depth);
+        } else {
+            const auto code = member.isClone ?
+                tempPrefix + "num = " + number(funcCall.children[2], depth) :
+                tempPrefix + "var = " + atom(funcCall.children[2], depth);
+            indent(depth);
+            out += code + ";\n";
+        }
+        indent(depth);
+        out += tempPrefix + "case = " + std::to_string(caseInd) + ";\n";
+        indent(depth);
+        out += "continue;\n";
+        return true;
+    }
+
+    /*
+     * Hands an unpacked member the halves of its argument, taking apart
+     * any that isn't a tuple literal. The current halves may still be in
+     * use working out the new ones, so neither is set until both are known
+     */
+    void unpackedJump(const Token &arg, const size_t depth) {
+        std::string first, second;
+        const auto &tuple = unwrap(arg);
+        if(tuple.type == TokenType::TupDef) {
+            first = atom(tuple.children[1], depth);
+            second = atom(tuple.children[3], depth);
+        } else {
+            const auto whole = atom(arg, depth);
+            first = "fst(" + whole + ")";
+            second = "snd(" + whole + ")";
+        }
+        const auto name = tempPrefix + std::to_string(nextTemp++);
+        indent(depth);
+        out += "const VariablePointer " + name + " = " + second + ";\n";
+        indent(depth);
+        out += tempPrefix + "var = " + first + ";\n";
+        indent(depth);
+        out += tempPrefix + "second = " + name + ";\n";
+    }
+
+    void branch(const Token &ternary, const std::string &dest, size_t depth) {
+        const auto cond = number(ternary.children[1], depth);
+        indent(depth);
+        out += "if(" + cond + " > 0) {\n";
+        store(ternary.children[3], dest, depth + 1);
+        indent(depth);
+        out += "} else {\n";
+        store(ternary.children[5], dest, depth + 1);
+        indent(depth);
+        out += "}\n";
+    }
+
+    static const Token &unwrap(const Token &expr) {
+        return expr.type == TokenType::Identifier ? expr : expr.children[0];
+    }
+};
+
+// Temporaries mustn't hide the parameter or any function that's called
+void collectIdentifiers(const Token &tok, std::vector<std::string> &idents) {
+    if(tok.type == TokenType::Identifier) {
+        idents.push_back(tok.value);
+    }
+    for(const auto &child : tok.children) {
+        collectIdentifiers(child, idents);
+    }
+}
+
+std::string codegen::tempPrefix(const Token &funcDef) {
+    return tempPrefix(std::vector<const Token *>({ &funcDef }));
+}
+
+std::string codegen::tempPrefix(const std::vector<const Token *> &funcDefs) {
+    std::vector<std::string> idents;
+    for(const auto funcDef : funcDefs) {
+        collectIdentifiers(*funcDef, idents);
+    }
+    std::string prefix = "t";
+    bool clashes = true;
+    while(clashes) {
+        clashes = false;
+        for(const auto &ident : idents) {
+            if(ident.compare(0, prefix.length(), prefix) == 0) {
+                clashes = true;
+                prefix += "_";
+                break;
+            }
+        }
+    }
+    return prefix;
+}
+
+void codegen::generateAnfCode(
+        const Token &funcDef, const types::TypeContext &types,
+        std::string &out) {
+    AnfLowering lowering = {
+        out, types, tempPrefix(funcDef), 0, nullptr, 0, false
+    };
+    lowering.store(funcDef.children[4], "", 1);
+}
+
+bool usesIdentifier(const Token &tok, const std::string &ident) {
+    std::vector<std::string> idents;
+    collectIdentifiers(tok, idents);
+    return std::find(idents.begin(), idents.end(), ident) != idents.end();
+}
+
+/*
+ * The count of steps (inc/dec calls around a tail call) still to do, and
+ * a lambda doing them on a result, in the order the calls would have
+ */
+void generateStepsCode(
+        const std::vector<std::string> &steps, const std::string &prefix,
+        std::string &out) {
+    std::string step = prefix + "value";
+    for(auto callee = steps.rbegin(); callee != steps.rend(); callee++) {
+        step = "(" + step + g_unboxedSteps.at(*callee) + ")";
+    }
+    out += "    size_t " + prefix + "pending = 0;\n";
+    out += "    const auto " + prefix + "steps =\n";
+    out += "        [&](const VariablePointer &" + prefix + "result) {\n";
+    out += "            if(" + prefix + "pending == 0) {\n";
+    out += "                return " + prefix + "result;\n";
+    out += "            }\n";
+    out += "            double " + prefix + "value = numberValue(";
+    out += prefix + "result);\n";
+    out += "            for(; " + prefix + "pending > 0; " + prefix;
+    out += "pending--) {\n";
+    out += "                " + prefix + "value = " + step + ";\n";
+    out += "            }\n";
+    out += "            return std::dynamic_pointer_cast<Variable>(\n";
+    out += "                std::make_shared<NumberVariable>(" + prefix;
+    out += "value)\n";
+    out += "            );\n";
+    out += "        };\n";
+}
+
+void codegen::generateTailGroupCode(
+        const tailcalls::TailGroups &tail, const size_t groupInd,
+        const types::TypeContext &types, std::string &out) {
+    const auto &group = tail.groups[groupInd];
+    std::vector<const Token *> funcDefs;
+    for(const auto &member : group.members) {
+        funcDefs.push_back(member.funcDef);
+    }
+    const auto prefix = tempPrefix(funcDefs);
+    std::vector<types::TypeContext> memberTypes;
+    bool cons = false;
+    for(const auto &member : group.members) {
+        memberTypes.push_back(types);
+        if(member.isClone) {
+            memberTypes.back().numberParam = member.funcDef->children[2].value;
+        } else if(isUnpackedMember(member, types)) {
+            memberTypes.back().tupleParam = member.funcDef->children[2].value;
+        }
+        std::string unused;
+        AnfLowering lowering = {
+            unused, memberTypes.back(), prefix, 0, &tail, groupInd, false
+        };
+        cons = cons || lowering.buildsCons(member.funcDef->children[4]);
+    }
+
+    out += tailGroupDecl(group, types, prefix);
+    out += " {\n";
+    if(cons) {
+        out += "    VariablePointer " + prefix + "result;\n";
+        out += "    VariablePointer *" + prefix + "dest = &" + prefix;
+        out += "result;\n";
+    }
+    if(group.steps.size() > 0) {
+        generateStepsCode(group.steps, prefix, out);
+    }
+    out += "    while(true) {\n        switch(" + prefix + "case) {\n";
+    for(size_t i = 0; i < group.members.size(); i++) {
+        const auto &member = group.members[i];
+        const auto &param = member.funcDef->children[2].value;
+        out += "            case " + std::to_string(i) + ": {\n";
+        if(isUnpackedMember(member, types)) {
+            out += "                [[maybe_unused]] const VariablePointer &";
+            out += types::tupleHalfName(param, "fst") + " = " + prefix;
+            out += "var;\n";
+            out += "                [[maybe_unused]] const VariablePointer &";
+            out += types::tupleHalfName(param, "snd") + " = " + prefix;
+            out += "second;\n";
+        } else if(usesIdentifier(member.funcDef->children[4], param)) {
+            out += "                ";
+            out += member.isClone ?
+                "const double " + param + " = " + prefix + "num;\n" :
+                "const VariablePointer &" + param + " = " + prefix + "var;\n";
+        }
+        AnfLowering lowering = {
+            out, memberTypes[i], prefix, 0, &tail, groupInd, cons
+        };
+        lowering.store(member.funcDef->children[4], "", 4);
+        out += "            }\n";
+    }
+    out += "        }\n    }\n}";
+}
+
+/*
+ * Everything is appended straight onto out. Building a string per node and
+ * joining them in the parent copies each byte once per level of nesting,
+ * which made deeply nested expressions quadratic
+ */
+void codegen::generateExprCode(
+        const Token &expr, const types::TypeContext &types,
+        std::string &out) {
+    const auto &subExpr = subExprOf(expr);
+    const auto constant = constantName(subExpr, types);
+    if(constant != "") {
+        out += constant;
+        return;
+    }
     switch(subExpr.type) {
         case TokenType::FuncCall:
-            return subExpr.children[0].value + "("
-                + generateExprCode(subExpr.children[2]) + ")";
+            if(isUnboxedCall(subExpr, types)) {
+                out += "std::make_shared<NumberVariable>(";
+                generateNumberCode(expr, types, out);
+                out += ")";
+                break;
+            }
+            if(types::callsNumberClone(subExpr, types)) {
+                out += types::numberCloneName(subExpr.children[0].value);
+                out += "(";
+                generateNumberCode(subExpr.children[2], types, out);
+                out += ")";
+                break;
+            }
+            if(types::callsTupleClone(subExpr, types)) {
+                // Arguments are evaluated in any order, the tuple's aren't
+                const auto &tuple = subExprOf(subExpr.children[2]);
+                const auto inOrder =
+                    !folding::isPure(tuple.children[1], types)
+                        && !folding::isPure(tuple.children[3], types);
+                if(inOrder) {
+                    out += "[&]() -> VariablePointer {\n";
+                    out += "    const VariablePointer first__ = ";
+                    generateExprCode(tuple.children[1], types, out);
+                    out += ";\n    return ";
+                }
+                out += types::tupleCloneName(subExpr.children[0].value);
+                out += "(";
+                if(inOrder) {
+                    out += "first__";
+                } else {
+                    generateExprCode(tuple.children[1], types, out);
+                }
+                out += ", ";
+                generateExprCode(tuple.children[3], types, out);
+                out += inOrder ? ");\n}()" : ")";
+                break;
+            }
+            if(unpackedHalf(subExpr, types) != "") {
+                out += unpackedHalf(subExpr, types);
+                break;
+            }
+            out += subExpr.children[0].value;
+            out += "(";
+            generateExprCode(subExpr.children[2], types, out);
+            out += ")";
+            break;
         
         case TokenType::Ternary:
-            return "std::dynamic_pointer_cast<NumberVariable>("
-                + generateExprCode(subExpr.children[1])
-                + "->toNumber())->value > 0 ? "
-                + generateExprCode(subExpr.children[3]) + " : "
-                + generateExprCode(subExpr.children[5]);
+            // The arms can be different kinds of Variable
+            generateNumberCode(subExpr.children[1], types, out);
+            out += " > 0 ? std::dynamic_pointer_cast<Variable>(";
+            generateExprCode(subExpr.children[3], types, out);
+            out += ") : std::dynamic_pointer_cast<Variable>(";
+            generateExprCode(subExpr.children[5], types, out);
+            out += ")";
+            break;
         
+        case TokenType::Let:
+            // The value is worked out once, before the body
+            out += "[&]() -> VariablePointer {\n";
+            out += "    [[maybe_unused]] const VariablePointer ";
+            out += subExpr.children[0].value;
+            out += " = ";
+            generateExprCode(subExpr.children[1], types, out);
+            out += ";\n    return ";
+            generateExprCode(subExpr.children[2], types, out);
+            out += ";\n}()";
+            break;
+
         case TokenType::String:
-            return "std::make_shared<StringVariable>(\""
-                + subExpr.value + "\")";
+            out += "std::make_shared<StringVariable>(\"";
+            out += subExpr.value;
+            out += "\")";
+            break;
         
         case TokenType::Decimal:
-            return "std::make_shared<NumberVariable>("
-                + subExpr.value + ")";
+            out += "std::make_shared<NumberVariable>(";
+            out += subExpr.value;
+            out += ")";
+            break;
         
         case TokenType::Hex:
-            return "std::make_shared<NumberVariable>("
-                "static_cast<double>(0x"
-                + subExpr.value + "))";
+            out += "std::make_shared<NumberVariable>(static_cast<double>(0x";
+            out += subExpr.value;
+            out += "))";
+            break;
         
         case TokenType::TupDef:
-            return "std::make_shared<TupleVariable>("
-                "std::make_pair<VariablePointer, VariablePointer>("
-                "std::dynamic_pointer_cast<Variable>("
-                + generateExprCode(subExpr.children[1]) + "), "
-                "std::dynamic_pointer_cast<Variable>("
-                + generateExprCode(subExpr.children[3]) + ")))";
+            // Braces evaluate the halves left to right, like a list's items
+            out +=
+                "std::make_shared<TupleVariable>("
+                "std::pair<VariablePointer, VariablePointer>{ ";
+            generateExprCode(subExpr.children[1], types, out);
+            out += ", ";
+            generateExprCode(subExpr.children[3], types, out);
+            out += " })";
+            break;
 
-        case TokenType::ListDef: {
-            std::stringstream subVarLs;
+        case TokenType::ListDef:
+            out +=
+                "std::make_shared<ListVariable>("
+                "std::vector<VariablePointer>({ ";
             for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
-                subVarLs
-                    << "std::dynamic_pointer_cast<Variable>("
-                    << generateExprCode(subExpr.children[i]) + "), ";
+                out += "std::dynamic_pointer_cast<Variable>(";
+                generateExprCode(subExpr.children[i], types, out);
+                out += "), ";
             }
-            return "std::make_shared<ListVariable>("
-                "std::vector<VariablePointer>({ "
-                + subVarLs.str() + " }))";
-        }
+            out += " }))";
+            break;
         
         case TokenType::Identifier:
-            return subExpr.value;
+            if(subExpr.value == types.numberParam) {
+                out += "std::make_shared<NumberVariable>(";
+                out += subExpr.value;
+                out += ")";
+                break;
+            }
+            out += subExpr.value;
+            break;
         
         default:
             break;
     }
-    return "";
+}
+
+void codegen::generateNumberCode(
+        const Token &expr, const types::TypeContext &types,
+        std::string &out) {
+    const auto &subExpr = subExprOf(expr);
+    switch(subExpr.type) {
+        case TokenType::Decimal:
+            out += "static_cast<double>(";
+            out += subExpr.value;
+            out += ")";
+            return;
+
+        case TokenType::Hex:
+            out += "static_cast<double>(0x";
+            out += subExpr.value;
+            out += ")";
+            return;
+
+        case TokenType::Identifier:
+            if(subExpr.value != types.numberParam) {
+                break;
+            }
+            out += subExpr.value;
+            return;
+
+        case TokenType::Ternary:
+            out += "(";
+            generateNumberCode(subExpr.children[1], types, out);
+            out += " > 0 ? ";
+            generateNumberCode(subExpr.children[3], types, out);
+            out += " : ";
+            generateNumberCode(subExpr.children[5], types, out);
+            out += ")";
+            return;
+
+        case TokenType::FuncCall: {
+            if(!isUnboxedCall(subExpr, types)) {
+                break;
+            }
+            const auto &callee = subExpr.children[0].value;
+            const auto step = g_unboxedSteps.find(callee);
+            out += "(";
+            if(step != g_unboxedSteps.end()) {
+                generateNumberCode(subExpr.children[2], types, out);
+                out += step->second;
+            } else {
+                /*
+                 * The operands of a > b are worked out in any order, so if
+                 * both have side effects the first is bound beforehand,
+                 * running them left to right like the tuple would
+                 */
+                const auto &tuple = subExprOf(subExpr.children[2]);
+                const auto inOrder =
+                    !folding::isPure(tuple.children[1], types)
+                        && !folding::isPure(tuple.children[3], types);
+                if(inOrder) {
+                    out += "[&]() -> double {\n";
+                    out += "    const double first__ = ";
+                    generateNumberCode(tuple.children[1], types, out);
+                    out += ";\n    return first__";
+                } else {
+                    generateNumberCode(tuple.children[1], types, out);
+                }
+                out += g_unboxedCompares.at(callee);
+                generateNumberCode(tuple.children[3], types, out);
+                out += " ? 1.0 : -1.0";
+                if(inOrder) {
+                    out += ";\n}()";
+                }
+            }
+            out += ")";
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    // Anything else is boxed, but std's number functions are known to be
+    if(types::inferType(expr, types) == types::ExprType::Number) {
+        out += "std::static_pointer_cast<NumberVariable>(";
+        generateExprCode(expr, types, out);
+        out += ")->value";
+    } else {
+        out += "numberValue(";
+        generateExprCode(expr, types, out);
+        out += ")";
+    }
 }
@@ -0,0 +1,664 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of constant folding of std calls
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+#include <ConstFold.hpp>
+#include <Inliner.hpp>
+
+using namespace nabd;
+using namespace nabd::folding;
+
+/*
+ * Running user functions while compiling is cut short (and left to run
+ * when the program does) past these, to keep compiling fast and nabc's
+ * own stack safe. Results are only inlined up to a certain size too
+ */
+const size_t g_callStepBudget = 100000;
+const size_t g_moduleStepBudget = 1000000;
+const size_t g_maxCallDepth = 256;
+const size_t g_maxFoldedSize = 4096;
+
+enum class ConstKind { Number, String, Tuple, List };
+
+// A value that's known when compiling. Tuples always have two items
+struct ConstValue {
+    ConstKind kind;
+    double number;
+    std::string str;
+    std::vector<ConstValue> items;
+};
+
+const Token &unwrap(const Token &expr) {
+    return expr.type == TokenType::Identifier ? expr : expr.children[0];
+}
+
+Token wrap(const Token &subExpr) {
+    return {
+        TokenType::Expr, "", subExpr.line, subExpr.col,
+        std::vector<Token>({ subExpr })
+    };
+}
+
+Token punctuation(const TokenType type, const std::string &value) {
+    return { type, value, 0, 0, std::vector<Token>() };
+}
+
+ConstValue makeNumber(const double number) {
+    return { ConstKind::Number, number, "", std::vector<ConstValue>() };
+}
+
+ConstValue makeTuple(const ConstValue &first, const ConstValue &second) {
+    return {
+        ConstKind::Tuple, 0, "", std::vector<ConstValue>({ first, second })
+    };
+}
+
+/*
+ * String tokens hold the text between the quotes as written, which is
+ * pasted into C++ (or C) as is. Only simple escapes are understood, so
+ * anything else is left for the C++ compiler
+ */
+bool unescape(const std::string &raw, std::string &str) {
+    const std::map<char, char> escapes = {
+        { 'n', '\n' }, { 't', '\t' }, { 'r', '\r' },
+        { '\\', '\\' }, { '\'', '\'' }, { '"', '"' }
+    };
+    for(size_t i = 0; i < raw.length(); i++) {
+        if(raw[i] == '"' || raw[i] == '\n') {
+            return false;
+        } else if(raw[i] != '\\') {
+            str += raw[i];
+            continue;
+        }
+        i++;
+        const auto escape = i < raw.length() ? escapes.find(raw[i]) :
+            escapes.end();
+        if(escape == escapes.end()) {
+            return false;
+        }
+        str += escape->second;
+    }
+    return true;
+}
+
+bool escape(const std::string &str, std::string &raw) {
+    for(const auto c : str) {
+        switch(c) {
+            case '\n': raw += "\\n"; break;
+            case '\t': raw += "\\t"; break;
+            case '\r': raw += "\\r"; break;
+            case '\\': raw += "\\\\"; break;
+            case '"': raw += "\\\""; break;
+            default:
+                if(static_cast<unsigned char>(c) < 0x20) {
+                    return false;
+                }
+                raw += c;
+                break;
+        }
+    }
+    return true;
+}
+
+// Whether a (folded) expression is made only of literals, and its value
+bool constValue(const Token &expr, ConstValue &value) {
+    const auto &subExpr = unwrap(expr);
+    switch(subExpr.type) {
+        case TokenType::Decimal:
+            // Too big for a double, so leave it to the C++ compiler
+            try {
+                value = makeNumber(std::stod(subExpr.value));
+            } catch(const std::out_of_range &) {
+                return false;
+            }
+            return true;
+
+        case TokenType::Hex:
+            if(subExpr.value.length() > 15) {
+                return false;
+            }
+            value = makeNumber(static_cast<double>(
+                std::stoull(subExpr.value, nullptr, 16)
+            ));
+            return true;
+
+        case TokenType::String:
+            value = { ConstKind::String, 0, "", std::vector<ConstValue>() };
+            return unescape(subExpr.value, value.str);
+
+        case TokenType::TupDef:
+        case TokenType::ListDef: {
+            value = {
+                subExpr.type == TokenType::TupDef ?
+                    ConstKind::Tuple : ConstKind::List,
+                0, "", std::vector<ConstValue>()
+            };
+            for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
+                ConstValue item;
+                if(!constValue(subExpr.children[i], item)) {
+                    return false;
+                }
+                value.items.push_back(item);
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+// Literal tokens for a value, where it can be written as one
+bool constToken(
+        const ConstValue &value, const Token &at, Token &expr) {
+    Token subExpr = { TokenType::Error, "", at.line, at.col, { } };
+    switch(value.kind) {
+        case ConstKind::Number: {
+            if(!std::isfinite(value.number)) {
+                return false;
+            }
+            std::stringstream number;
+            number.precision(17);
+            number << value.number;
+            subExpr.type = TokenType::Decimal;
+            subExpr.value = number.str();
+            if(value.number == 0 && std::signbit(value.number)) {
+                // -0 would be the integer 0, which loses the sign
+                subExpr.value = "-0.0";
+            }
+            break;
+        }
+
+        case ConstKind::String:
+            subExpr.type = TokenType::String;
+            if(!escape(value.str, subExpr.value)) {
+                return false;
+            }
+            break;
+
+        case ConstKind::Tuple:
+        case ConstKind::List: {
+            const auto isTuple = value.kind == ConstKind::Tuple;
+            subExpr.type = isTuple ? TokenType::TupDef : TokenType::ListDef;
+            subExpr.children.push_back(
+                isTuple ?
+                    punctuation(TokenType::LCurl, "{") :
+                    punctuation(TokenType::LBrak, "[")
+            );
+            for(size_t i = 0; i < value.items.size(); i++) {
+                if(i > 0) {
+                    subExpr.children.push_back(
+                        punctuation(TokenType::Comma, ",")
+                    );
+                }
+                Token item;
+                if(!constToken(value.items[i], at, item)) {
+                    return false;
+                }
+                subExpr.children.push_back(item);
+            }
+            subExpr.children.push_back(
+                isTuple ?
+                    punctuation(TokenType::RCurl, "}") :
+                    punctuation(TokenType::RBrak, "]")
+            );
+            break;
+        }
+    }
+    expr = wrap(subExpr);
+    return true;
+}
+
+// The conversions in Variable.cpp. Empty lists have no number to give
+bool toNumber(const ConstValue &value, double &number) {
+    switch(value.kind) {
+        case ConstKind::Number:
+            number = value.number;
+            return true;
+
+        case ConstKind::String:
+            number = value.str.length() > 0 ?
+                static_cast<double>(value.str[0]) : 0;
+            return true;
+
+        case ConstKind::Tuple:
+            return toNumber(value.items[0], number);
+
+        default:
+            return value.items.size() > 0
+                && toNumber(value.items[0], number);
+    }
+}
+
+ConstValue toTuple(const ConstValue &value) {
+    return value.kind == ConstKind::Tuple ? value : makeTuple(value, value);
+}
+
+// The runtimes disagree on how lists are written, so those aren't known
+bool toString(const ConstValue &value, std::string &str) {
+    switch(value.kind) {
+        case ConstKind::Number:
+            str = std::to_string(value.number);
+            return true;
+
+        case ConstKind::String:
+            str = value.str;
+            return true;
+
+        case ConstKind::Tuple: {
+            std::string first, second;
+            if(!toString(value.items[0], first)
+                    || !toString(value.items[1], second)) {
+                return false;
+            }
+            str = "(" + first + ", " + second + ")";
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+// What len and elem see, i.e. toList({ VariableType::Tuple })
+std::vector<ConstValue> toTupleList(const ConstValue &value) {
+    return value.kind == ConstKind::List ?
+        value.items :
+        std::vector<ConstValue>({ toTuple(value) });
+}
+
+const std::map<std::string, bool (*)(double, double)> g_compares = {
+    { "gt", [](double a, double b) { return a > b; } },
+    { "lt", [](double a, double b) { return a < b; } },
+    { "eq", [](double a, double b) { return a == b; } },
+    { "gte", [](double a, double b) { return a >= b; } },
+    { "lte", [](double a, double b) { return a <= b; } },
+    { "ne", [](double a, double b) { return a != b; } }
+};
+const std::map<std::string, double (*)(double)> g_numberFuncs = {
+    { "inc", [](double num) { return num + 1; } },
+    { "dec", [](double num) { return num - 1; } },
+    { "round", [](double num) { return std::round(num); } },
+    { "floor", [](double num) { return std::floor(num); } },
+    { "ceil", [](double num) { return std::ceil(num); } }
+};
+
+bool isPureStd(const std::string &callee) {
+    return g_compares.count(callee) > 0 || g_numberFuncs.count(callee) > 0
+        || callee == "fst" || callee == "snd" || callee == "dup"
+        || callee == "len" || callee == "elem";
+}
+
+// How many values make up a value, counting itself
+size_t constSize(const ConstValue &value) {
+    size_t size = 1;
+    for(const auto &item : value.items) {
+        size += constSize(item);
+    }
+    return size;
+}
+
+// What a pure std function (see lib/src/std.cpp) gives for arg
+bool evalStd(
+        const std::string &callee, const ConstValue &arg,
+        ConstValue &result) {
+    const auto compare = g_compares.find(callee);
+    if(compare != g_compares.end()) {
+        const auto tuple = toTuple(arg);
+        double first, second;
+        if(!toNumber(tuple.items[0], first)
+                || !toNumber(tuple.items[1], second)) {
+            return false;
+        }
+        result = makeNumber(compare->second(first, second) ? 1 : -1);
+        return true;
+    }
+
+    const auto numberFunc = g_numberFuncs.find(callee);
+    if(numberFunc != g_numberFuncs.end()) {
+        double number;
+        if(!toNumber(arg, number)) {
+            return false;
+        }
+        result = makeNumber(numberFunc->second(number));
+        return true;
+    }
+
+    if(callee == "fst" || callee == "snd") {
+        result = toTuple(arg).items[callee == "fst" ? 0 : 1];
+        return true;
+    } else if(callee == "dup") {
+        result = makeTuple(arg, arg);
+        return true;
+    } else if(callee == "len") {
+        result = makeNumber(static_cast<double>(toTupleList(arg).size()));
+        return true;
+    } else if(callee == "elem") {
+        const auto pair = toTuple(arg);
+        const auto list = toTupleList(pair.items[1]);
+        double index;
+        if(!toNumber(pair.items[0], index)
+                || std::isnan(index) || index < 0) {
+            return false;
+        }
+        result = index >= list.size() ? arg : list[static_cast<size_t>(index)];
+        return true;
+    }
+    return false;
+}
+
+bool folding::isPure(const Token &expr, const types::TypeContext &ctx) {
+    const auto &subExpr = unwrap(expr);
+    if(subExpr.type == TokenType::FuncCall
+            && !(
+                types::isStdCall(subExpr, ctx)
+                    && isPureStd(subExpr.children[0].value)
+            )) {
+        return false;
+    }
+    for(const auto &child : subExpr.children) {
+        if(child.type == TokenType::Expr && !isPure(child, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * fst, snd and elem of a literal whose other parts don't need evaluating
+ * give back that part as written, even if it isn't constant
+ */
+bool foldProjection(
+        const Token &funcCall, const types::TypeContext &ctx,
+        Token &result) {
+    const auto &callee = funcCall.children[0].value;
+    const auto &arg = unwrap(funcCall.children[2]);
+    if(arg.type != TokenType::TupDef) {
+        return false;
+    }
+
+    size_t keep;
+    const Token *parts;
+    if(callee == "fst" || callee == "snd") {
+        keep = callee == "fst" ? 1 : 3;
+        parts = &arg;
+    } else if(callee == "elem") {
+        ConstValue index;
+        const auto &list = unwrap(arg.children[3]);
+        if(list.type != TokenType::ListDef
+                || !constValue(arg.children[1], index)
+                || index.kind != ConstKind::Number
+                || index.number < 0
+                || index.number >= (list.children.size() - 1) / 2) {
+            return false;
+        }
+        keep = 1 + 2 * static_cast<size_t>(index.number);
+        parts = &list;
+    } else {
+        return false;
+    }
+
+    for(size_t i = 1; i < parts->children.size() - 1; i += 2) {
+        if(i != keep && !isPure(parts->children[i], ctx)) {
+            return false;
+        }
+    }
+    result = parts->children[keep];
+    return true;
+}
+
+// Whether everything expr calls is pure std or one of pureFuncs
+bool callsOnly(
+        const Token &tok, const types::TypeContext &ctx,
+        const std::map<std::string, const Token *> &pureFuncs) {
+    if(tok.type == TokenType::FuncCall) {
+        const auto &callee = tok.children[0].value;
+        const auto isPureCall = types::isStdCall(tok, ctx) ?
+            isPureStd(callee) : pureFuncs.count(callee) > 0;
+        if(!isPureCall) {
+            return false;
+        }
+    }
+    for(const auto &child : tok.children) {
+        if(!callsOnly(child, ctx, pureFuncs)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Functions from other modules aren't known here, so calling one isn't pure
+std::map<std::string, const Token *> folding::findPureFuncs(
+        const Token &program, const types::TypeContext &ctx) {
+    std::map<std::string, const Token *> pureFuncs;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef
+                && topLevelTok.children[0].value != "main") {
+            pureFuncs[topLevelTok.children[0].value] = &topLevelTok;
+        }
+    }
+
+    bool changed = true;
+    while(changed) {
+        changed = false;
+        for(auto func = pureFuncs.begin(); func != pureFuncs.end(); ) {
+            if(callsOnly(func->second->children[4], ctx, pureFuncs)) {
+                func++;
+            } else {
+                func = pureFuncs.erase(func);
+                changed = true;
+            }
+        }
+    }
+    return pureFuncs;
+}
+
+struct Folder {
+    const types::TypeContext &ctx;
+    std::map<std::string, const Token *> pureFuncs;
+
+    // Steps left for the module, and taken by the call being evaluated
+    size_t moduleSteps, steps, depth;
+
+    // Runs expr with the names in env bound, within the budgets
+    bool eval(
+            const Token &expr,
+            std::vector<std::pair<std::string, ConstValue>> &env,
+            ConstValue &result) {
+        steps++;
+        if(steps > g_callStepBudget || steps > moduleSteps) {
+            return false;
+        }
+
+        const auto &subExpr = unwrap(expr);
+        switch(subExpr.type) {
+            case TokenType::Identifier:
+                for(auto bound = env.rbegin(); bound != env.rend(); bound++) {
+                    if(bound->first == subExpr.value) {
+                        result = bound->second;
+                        return true;
+                    }
+                }
+                return false;
+
+            case TokenType::Decimal:
+            case TokenType::Hex:
+            case TokenType::String:
+                return constValue(expr, result);
+
+            case TokenType::TupDef:
+            case TokenType::ListDef:
+                result = {
+                    subExpr.type == TokenType::TupDef ?
+                        ConstKind::Tuple : ConstKind::List,
+                    0, "", std::vector<ConstValue>()
+                };
+                for(size_t i = 1; i < subExpr.children.size() - 1; i += 2) {
+                    ConstValue item;
+                    if(!eval(subExpr.children[i], env, item)) {
+                        return false;
+                    }
+                    result.items.push_back(item);
+                }
+                return true;
+
+            case TokenType::Ternary: {
+                ConstValue cond;
+                double condNum;
+                if(!eval(subExpr.children[1], env, cond)
+                        || !toNumber(cond, condNum)) {
+                    return false;
+                }
+                return eval(
+                    subExpr.children[condNum > 0 ? 3 : 5], env, result
+                );
+            }
+
+            case TokenType::Let: {
+                ConstValue value;
+                if(!eval(subExpr.children[1], env, value)) {
+                    return false;
+                }
+                env.push_back({ subExpr.children[0].value, value });
+                const auto done = eval(subExpr.children[2], env, result);
+                env.pop_back();
+                return done;
+            }
+
+            case TokenType::FuncCall: {
+                ConstValue callArg;
+                if(!eval(subExpr.children[2], env, callArg)) {
+                    return false;
+                }
+                if(types::isStdCall(subExpr, ctx)) {
+                    return evalStd(subExpr.children[0].value, callArg, result);
+                }
+                const auto func = pureFuncs.find(subExpr.children[0].value);
+                return func != pureFuncs.end()
+                    && evalCall(*func->second, callArg, result);
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    bool evalCall(
+            const Token &funcDef, const ConstValue &arg, ConstValue &result) {
+        if(depth >= g_maxCallDepth) {
+            return false;
+        }
+        depth++;
+        std::vector<std::pair<std::string, ConstValue>> env = {
+            { funcDef.children[2].value, arg }
+        };
+        const auto done = eval(funcDef.children[4], env, result);
+        depth--;
+        return done;
+    }
+
+    // A pure user function called with a constant, run now
+    bool foldUserCall(const Token &funcCall, Token &folded) {
+        const auto func = pureFuncs.find(funcCall.children[0].value);
+        ConstValue arg, result;
+        if(func == pureFuncs.end() || moduleSteps == 0
+                || !constValue(funcCall.children[2], arg)) {
+            return false;
+        }
+        steps = 0;
+        depth = 0;
+        const auto done = evalCall(*func->second, arg, result);
+        moduleSteps -= std::min(steps, moduleSteps);
+        return done && constSize(result) <= g_maxFoldedSize
+            && constToken(result, funcCall.children[0], folded);
+    }
+
+    Token fold(const Token &expr) {
+        if(expr.type != TokenType::Expr) {
+            return expr;
+        }
+        auto subExpr = expr.children[0];
+        for(auto &child : subExpr.children) {
+            if(child.type == TokenType::Expr) {
+                child = fold(child);
+            }
+        }
+
+        if(subExpr.type == TokenType::Ternary) {
+            ConstValue cond;
+            double condNum;
+            if(constValue(subExpr.children[1], cond)
+                    && toNumber(cond, condNum)) {
+                return subExpr.children[condNum > 0 ? 3 : 5];
+            }
+        } else if(subExpr.type == TokenType::Let) {
+            // A constant (or a name) can go straight where it's used
+            const auto &name = subExpr.children[0].value;
+            const auto &value = subExpr.children[1];
+            ConstValue unused;
+            if(unwrap(value).type == TokenType::Identifier
+                    || constValue(value, unused)) {
+                return fold(inlining::substitute(
+                    subExpr.children[2], name, value
+                ));
+            } else if(inlining::countUses(subExpr.children[2], name) == 0
+                    && isPure(value, ctx)) {
+                return subExpr.children[2];
+            }
+        } else if(subExpr.type == TokenType::FuncCall
+                && !types::isStdCall(subExpr, ctx)) {
+            Token folded;
+            if(foldUserCall(subExpr, folded)) {
+                return folded;
+            }
+        } else if(subExpr.type == TokenType::FuncCall) {
+            const auto &callee = subExpr.children[0].value;
+            ConstValue arg, result;
+            Token folded;
+            const auto isConst = constValue(subExpr.children[2], arg);
+            if(isConst && evalStd(callee, arg, result)
+                    && constToken(result, subExpr.children[0], folded)) {
+                return folded;
+            } else if(!isConst && foldProjection(subExpr, ctx, folded)) {
+                return folded;
+            }
+
+            // print still prints, but without converting anything first
+            std::string str;
+            if(callee == "print" && isConst && arg.kind != ConstKind::String
+                    && toString(arg, str)) {
+                result = {
+                    ConstKind::String, 0, str, std::vector<ConstValue>()
+                };
+                if(constToken(result, subExpr.children[2], folded)) {
+                    subExpr.children[2] = folded;
+                }
+            }
+        }
+        return wrap(subExpr);
+    }
+};
+
+Token folding::foldConstants(
+        const Token &program, const types::TypeContext &ctx) {
+    Folder folder = {
+        ctx, findPureFuncs(program, ctx), g_moduleStepBudget, 0, 0
+    };
+    auto folded = program;
+    for(auto &topLevelTok : folded.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            topLevelTok.children[4] = folder.fold(topLevelTok.children[4]);
+        }
+    }
+    return folded;
+}
@@ -0,0 +1,214 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of common subexpression elimination
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+#include <ConstFold.hpp>
+#include <Inliner.hpp>
+#include <Cse.hpp>
+
+using namespace nabd;
+
+// Type and value of every token in tok, so equal expressions get equal keys
+void appendExprKey(const Token &tok, std::string &key) {
+    key += std::to_string(static_cast<int>(tok.type));
+    key += ":" + tok.value + "(";
+    for(const auto &child : tok.children) {
+        appendExprKey(child, key);
+    }
+    key += ")";
+}
+
+// The names expr uses, leaving out callees
+void collectUsedNames(const Token &expr, std::set<std::string> &names) {
+    if(expr.type == TokenType::Identifier) {
+        names.insert(expr.value);
+        return;
+    }
+    const size_t first = expr.type == TokenType::FuncCall ? 1 : 0;
+    for(size_t i = first; i < expr.children.size(); i++) {
+        collectUsedNames(expr.children[i], names);
+    }
+}
+
+// Where a repeated call shows up in the part of a function being looked at
+struct Occurrences {
+    size_t sure, total, order;
+    Token expr;
+};
+
+struct SubexprFinder {
+    const types::TypeContext &ctx;
+    const types::TypeContext &cloneCtx;
+    const std::string &prefix;
+    size_t &nextTemp;
+
+    /*
+     * Pure std calls that give something other than a number (numbers are
+     * cheaper to work out again than to box), in the generic function or
+     * its number clone, and only use names bound outside of the region
+     */
+    bool isCandidate(
+            const Token &expr, const std::set<std::string> &visible) {
+        if(expr.children[0].type != TokenType::FuncCall
+                || !folding::isPure(expr, ctx)
+                || types::inferType(expr, ctx) == types::ExprType::Number
+                || types::inferType(expr, cloneCtx)
+                    == types::ExprType::Number) {
+            return false;
+        }
+        std::set<std::string> names;
+        collectUsedNames(expr, names);
+        for(const auto &name : names) {
+            if(visible.count(name) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+     * Counts the calls in expr. sure is whether expr is always worked out
+     * when the region is, which stops at ternary arms
+     */
+    void count(
+            const Token &expr, const bool sure,
+            const std::set<std::string> &visible,
+            std::map<std::string, Occurrences> &found) {
+        if(expr.type == TokenType::Expr && isCandidate(expr, visible)) {
+            std::string key;
+            appendExprKey(expr.children[0], key);
+            auto &occurrences = found.insert({
+                key, { 0, 0, found.size(), expr.children[0] }
+            }).first->second;
+            occurrences.sure += sure ? 1 : 0;
+            occurrences.total++;
+        }
+        if(expr.type == TokenType::Ternary) {
+            count(expr.children[1], sure, visible, found);
+            count(expr.children[3], false, visible, found);
+            count(expr.children[5], false, visible, found);
+            return;
+        }
+        const size_t first =
+            expr.type == TokenType::FuncCall || expr.type == TokenType::Let ?
+                1 : 0;
+        for(size_t i = first; i < expr.children.size(); i++) {
+            count(expr.children[i], sure, visible, found);
+        }
+    }
+
+    Token replace(
+            const Token &expr, const std::string &key, const Token &name) {
+        if(expr.type == TokenType::Expr) {
+            std::string exprKey;
+            appendExprKey(expr.children[0], exprKey);
+            if(exprKey == key) {
+                return {
+                    TokenType::Expr, "", expr.line, expr.col,
+                    std::vector<Token>({ name })
+                };
+            }
+        }
+        auto result = expr;
+        for(auto &child : result.children) {
+            child = replace(child, key, name);
+        }
+        return result;
+    }
+
+    /*
+     * Binds the biggest call that's repeated and sure to be worked out (at
+     * least once) around region, until there are none, then does the same
+     * for each ternary arm
+     */
+    Token eliminate(const Token &region, std::set<std::string> visible) {
+        auto result = region;
+        while(true) {
+            std::map<std::string, Occurrences> found;
+            count(result, true, visible, found);
+            const std::pair<const std::string, Occurrences> *best = nullptr;
+            for(const auto &entry : found) {
+                const auto &occurrences = entry.second;
+                if(occurrences.sure == 0 || occurrences.total < 2) {
+                    continue;
+                }
+                const auto size = entry.first.length();
+                if(best == nullptr || size > best->first.length()
+                        || (size == best->first.length()
+                            && occurrences.order < best->second.order)) {
+                    best = &entry;
+                }
+            }
+            if(best == nullptr) {
+                break;
+            }
+
+            const Token name = {
+                TokenType::Identifier, prefix + std::to_string(nextTemp++),
+                region.line, region.col, std::vector<Token>()
+            };
+            const Token let = {
+                TokenType::Let, "", region.line, region.col,
+                std::vector<Token>({
+                    name,
+                    {
+                        TokenType::Expr, "", region.line, region.col,
+                        std::vector<Token>({ best->second.expr })
+                    },
+                    replace(result, best->first, name)
+                })
+            };
+            result = {
+                TokenType::Expr, "", region.line, region.col,
+                std::vector<Token>({ let })
+            };
+        }
+        return eliminateInArms(result, visible);
+    }
+
+    Token eliminateInArms(
+            const Token &expr, const std::set<std::string> &visible) {
+        auto result = expr;
+        if(expr.type == TokenType::Ternary) {
+            result.children[1] = eliminateInArms(expr.children[1], visible);
+            result.children[3] = eliminate(expr.children[3], visible);
+            result.children[5] = eliminate(expr.children[5], visible);
+        } else if(expr.type == TokenType::Let) {
+            auto inBody = visible;
+            inBody.insert(expr.children[0].value);
+            result.children[1] = eliminateInArms(expr.children[1], visible);
+            result.children[2] = eliminateInArms(expr.children[2], inBody);
+        } else {
+            for(auto &child : result.children) {
+                child = eliminateInArms(child, visible);
+            }
+        }
+        return result;
+    }
+};
+
+Token cse::eliminateCommonSubexprs(
+        const Token &program, const types::TypeContext &ctx) {
+    auto result = program;
+    const auto prefix = inlining::letPrefix(program, "c");
+    size_t nextTemp = 0;
+    for(auto &topLevelTok : result.children) {
+        if(topLevelTok.type != TokenType::FuncDef) {
+            continue;
+        }
+        const auto &param = topLevelTok.children[2].value;
+        auto cloneCtx = ctx;
+        cloneCtx.numberParam = param;
+        SubexprFinder finder = { ctx, cloneCtx, prefix, nextTemp };
+        topLevelTok.children[4] =
+            finder.eliminate(topLevelTok.children[4], { param });
+    }
+    return result;
+}
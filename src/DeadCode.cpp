@@ -0,0 +1,62 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of dropping unreachable definitions
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <Token.hpp>
+#include <DeadCode.hpp>
+
+using namespace nabd;
+
+void addCalledNames(const Token &tok, std::set<std::string> &names) {
+    if(tok.type == TokenType::FuncCall) {
+        names.insert(tok.children[0].value);
+    }
+    for(const auto &child : tok.children) {
+        addCalledNames(child, names);
+    }
+}
+
+std::set<std::string> deadcode::calledNames(const Token &tok) {
+    std::set<std::string> names;
+    addCalledNames(tok, names);
+    return names;
+}
+
+Token deadcode::dropUnreachable(const Token &program) {
+    std::map<std::string, const Token *> funcDefs;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            funcDefs[topLevelTok.children[0].value] = &topLevelTok;
+        }
+    }
+    if(funcDefs.count("main") == 0) {
+        return program;
+    }
+
+    std::set<std::string> reached = { "main" };
+    std::vector<std::string> toVisit = { "main" };
+    while(!toVisit.empty()) {
+        const auto funcDef = funcDefs.at(toVisit.back());
+        toVisit.pop_back();
+        for(const auto &callee : calledNames(funcDef->children[4])) {
+            if(funcDefs.count(callee) > 0 && reached.insert(callee).second) {
+                toVisit.push_back(callee);
+            }
+        }
+    }
+
+    Token result = program;
+    result.children.clear();
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type != TokenType::FuncDef
+                || reached.count(topLevelTok.children[0].value) > 0) {
+            result.children.push_back(topLevelTok);
+        }
+    }
+    return result;
+}
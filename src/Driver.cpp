@@ -0,0 +1,343 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the steps of building a module or program
+ */
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <Utility.hpp>
+#include <Parser.hpp>
+#include <FileIo.hpp>
+#include <CodeGen.hpp>
+#include <BuildGraph.hpp>
+#include <ModuleCache.hpp>
+#include <Timing.hpp>
+#include <Driver.hpp>
+
+using namespace nabd;
+
+void nabd::runCompiler(InputArguments inputs, const std::string &nabcPath) {
+    const auto start = std::chrono::steady_clock::now();
+    phaseTimings() = PhaseTimings();
+
+    // Emitting a build file logs each module as it translates it instead
+    const auto modInfo =
+        inputs.emitNinja ? moduleInfoFor(inputs) : extractModuleInfo(inputs);
+
+    std::string mode;
+    if(inputs.emitNinja) {
+        mode = "ninja";
+        emitNinjaBuild(inputs, nabcPath);
+    } else if(!inputs.link) {
+        inputs.includeFolders.push_back(modInfo.relativeDirectory);
+        const auto program = loadModule(modInfo.fileName);
+        const auto cppCode = compile(*program, inputs, modInfo);
+        if(inputs.translateOnly) {
+            mode = "translate";
+            translate(*program, cppCode, inputs, modInfo);
+        } else {
+            mode = "module";
+            buildObj(cppCode, inputs, modInfo);
+        }
+    } else {
+        mode = "link";
+        link(inputs, modInfo);
+    }
+
+    if(inputs.timingsFile != "") {
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        appendTimings(
+            inputs.timingsFile, modInfo.moduleName, mode,
+            phaseTimings(), elapsed.count()
+        );
+    }
+}
+
+codegen::ModuleCode nabd::compile(
+        const Token &program,
+        const InputArguments &cliInputs, const ModuleInfo &modInfo) {
+    PhaseTimer timer(phaseTimings().codeGenMs);
+    return codegen::generateModuleCode(program, cliInputs, modInfo);
+}
+
+/*
+ * Writes the module's shards (and their shared declarations header) into its
+ * build folder, returning the shard names. Unchanged files are left alone so
+ * only the shards that changed get rebuilt
+ */
+std::vector<std::string> writeModuleSources(
+        const codegen::ModuleCode &code,
+        const InputArguments &cliInputs, const ModuleInfo &modInfo) {
+    if(code.shards.size() > 1) {
+        const auto declsPath =
+            modInfo.buildFolder + "/" + codegen::declarationsName(modInfo);
+        if(!writeFileIfChanged(declsPath, code.declarations)) {
+            errorOut("Failed to create the declarations header!");
+        }
+    }
+
+    std::vector<std::string> shardNames;
+    for(size_t i = 0; i < code.shards.size(); i++) {
+        shardNames.push_back(
+            codegen::shardName(modInfo, i, code.shards.size())
+        );
+        const auto cppPath =
+            modInfo.buildFolder + "/" + shardNames.back()
+            + codegen::sourceExtension(cliInputs);
+        if(!writeFileIfChanged(cppPath, code.shards[i])) {
+            errorOut("Failed to create the cpp file!");
+        }
+    }
+
+    if(cliInputs.cBackend) {
+        if(!writeFileIfChanged(
+                modInfo.buildFolder + "/NabdRuntime.h", g_cRuntimeH)
+                || !writeFileIfChanged(
+                    modInfo.buildFolder + "/NabdStd.h", g_cStdH)) {
+            errorOut("Failed to create the C runtime headers!");
+        }
+        return shardNames;
+    }
+
+    // Output the needed Variable.hpp file
+    const auto varHppPath = modInfo.buildFolder + "/Variable.hpp";
+    if(!writeFileIfChanged(varHppPath, g_varHpp)) {
+        errorOut("Failed to create the Variable.hpp file!");
+    }
+
+    return shardNames;
+}
+
+/*
+ * Only generate the C++ (plus a depfile) and leave compiling to the caller.
+ * Files are left untouched when unchanged so build tools can skip work
+ */
+void nabd::translate(
+        const Token &program,
+        const codegen::ModuleCode &code,
+        const InputArguments &cliInputs, const ModuleInfo &modInfo) {
+    const auto shardNames = writeModuleSources(code, cliInputs, modInfo);
+
+    // Named after the first output, which is what ninja expects
+    const auto firstCppPath =
+        modInfo.buildFolder + "/" + shardNames[0]
+        + codegen::sourceExtension(cliInputs);
+    const auto deps = moduleDependencies(program, cliInputs, modInfo);
+    if(!writeFileIfChanged(
+            firstCppPath + ".d", generateDepFile(firstCppPath, deps))) {
+        errorOut("Failed to create the dependency file!");
+    }
+}
+
+void nabd::buildObj(
+        const codegen::ModuleCode &code,
+        const InputArguments &cliInputs, const ModuleInfo &modInfo) {
+    const auto shardNames = writeModuleSources(code, cliInputs, modInfo);
+
+    // Output the Makefile
+    const auto makefileSrc = generateMakefile(cliInputs, modInfo, shardNames);
+    const auto makefilePath = modInfo.buildFolder + "/Makefile";
+    if(!writeFileIfChanged(makefilePath, makefileSrc)) {
+        errorOut("Failed to create Makefile!");
+    }
+
+    // Run make in the build folder, building shards side by side
+    const auto jobs = std::max<size_t>(
+        1, std::min<size_t>(
+            shardNames.size(), std::thread::hardware_concurrency()
+        )
+    );
+    const auto makeCmd =
+#if defined(_WIN32) || defined(WIN32)
+        "mingw32-make"
+#else
+        "make"
+#endif
+        " -j" + std::to_string(jobs)
+        + " -C " + modInfo.buildFolder;
+    {
+        PhaseTimer timer(phaseTimings().cxxMs);
+        if(!runCommand(makeCmd)) {
+            errorOut("Failed to build object file!");
+        }
+    }
+
+    // Copy the new object file back to the
+    const auto copyCmd =
+#if defined(_WIN32) || defined(WIN32)
+        "powershell -command \"copy "
+#else
+        "cp "
+#endif
+        + modInfo.buildFolder + "/" + modInfo.moduleName + ".o "
+        + (modInfo.relativeDirectory == "" ? "." : modInfo.relativeDirectory)
+#if defined(_WIN32) || defined(WIN32)
+        + "\"";
+#else
+        ;
+#endif
+    if(!runCommand(copyCmd)) {
+        errorOut("Failed to copy object file from build folder to root dir!");
+    }
+}
+
+// Writes out and compiles Variable.cpp, returning the object's path
+std::string buildCppRuntime(const ModuleInfo &modInfo) {
+    // Output Variable.hpp (needed by Variable.cpp)
+    const auto varHppPath = modInfo.buildFolder + "/Variable.hpp";
+    if(!writeFileIfChanged(varHppPath, g_varHpp)) {
+        errorOut("Failed to create the Variable.hpp file!");
+    }
+    
+    // Output Variable.cpp
+    const auto varCppPath = modInfo.buildFolder + "/Variable.cpp";
+    bool varCppChanged = false;
+    if(!writeFileIfChanged(varCppPath, g_varCpp, &varCppChanged)) {
+        errorOut("Failed to create the Variable.cpp file!");
+    }
+
+    // Compile the Variable.cpp file (unless we still have it from last time)
+    const auto varCompCmd =
+#if defined(_WIN32) || defined(WIN32)
+        "mingw32-g++ "
+#else
+        "g++ "
+#endif
+        "-O2 -Wall -Werror -std=c++17 -ffunction-sections -fdata-sections "
+        "-I\"" + modInfo.buildFolder + "\" -o "
+        + modInfo.buildFolder + "/Variable.o -c " + modInfo.buildFolder
+        + "/Variable.cpp";
+    std::ifstream varObj(modInfo.buildFolder + "/Variable.o");
+    if(varCppChanged || !varObj.is_open()) {
+        PhaseTimer timer(phaseTimings().cxxMs);
+        if(!runCommand(varCompCmd)) {
+            errorOut("Failed to compile Variable.cpp!");
+        }
+    }
+    return modInfo.buildFolder + "/Variable.o";
+}
+
+// The C backend's version of the above, using the chosen C compiler
+std::string buildCRuntime(
+        const InputArguments &cliInputs, const ModuleInfo &modInfo) {
+    const auto rtHPath = modInfo.buildFolder + "/NabdRuntime.h";
+    const auto rtCPath = modInfo.buildFolder + "/NabdRuntime.c";
+    bool rtChanged = false;
+    if(!writeFileIfChanged(rtHPath, g_cRuntimeH)
+            || !writeFileIfChanged(rtCPath, g_cRuntimeC, &rtChanged)) {
+        errorOut("Failed to create the C runtime!");
+    }
+
+    // Flags are part of the name so switching --debug rebuilds it
+    const auto flags = cCompileFlags(cliInputs);
+    const auto rtObjPath =
+        modInfo.buildFolder + "/NabdRuntime"
+        + (cliInputs.debug ? "_debug" : "") + ".o";
+    std::ifstream rtObj(rtObjPath);
+    if(rtChanged || !rtObj.is_open()) {
+        PhaseTimer timer(phaseTimings().cxxMs);
+        if(!runCommand(
+                cliInputs.cCompiler + " " + flags + " -I\""
+                    + modInfo.buildFolder + "\" -o " + rtObjPath
+                    + " -c " + rtCPath)) {
+            errorOut("Failed to compile NabdRuntime.c!");
+        }
+    }
+    return rtObjPath;
+}
+
+void nabd::link(
+        const InputArguments &cliInputs,
+        const ModuleInfo &modInfo) {
+    if(!dirExists(modInfo.buildFolder)) {
+        logOut()
+            << "Build folder '" << modInfo.buildFolder
+            << "' does not exist. Creating!" << std::endl;
+    }
+    createDirectory(modInfo.buildFolder);
+
+    // The runtime every module calls into
+    const auto runtimeObj =
+        cliInputs.cBackend ?
+            buildCRuntime(cliInputs, modInfo) :
+            buildCppRuntime(modInfo);
+
+    // Link
+    std::stringstream linkCmd;
+    if(cliInputs.cBackend) {
+        linkCmd << cliInputs.cCompiler << " ";
+    } else {
+#if defined(_WIN32) || defined(WIN32)
+        linkCmd << "mingw32-g++ ";
+#else
+        linkCmd << "g++ ";
+#endif
+    }
+    linkCmd << "-o " + modInfo.buildFolder + "/" + modInfo.moduleName << " ";
+    for(const auto &obj : cliInputs.objects) {
+        linkCmd << obj << " ";
+    }
+    linkCmd << runtimeObj << " ";
+    for(const auto &folder : cliInputs.linkFolders) {
+        linkCmd << "-L" << folder << " ";
+    }
+    linkCmd << "-L" << modInfo.buildFolder << " ";
+    for(const auto &lib : cliInputs.libraryNames) {
+        linkCmd << "-l" << lib << " ";
+    }
+    // The C backend's std is compiled into each module that includes it
+    const auto stdLibFolder =
+        cliInputs.cBackend ? "" : findStdLibFolder(cliInputs);
+    if(stdLibFolder != "") {
+        linkCmd << "-L\"" << stdLibFolder << "\" -lnabdstd ";
+    } else if(!cliInputs.cBackend) {
+        logOut()
+            << "Couldn't find libnabdstd.a, so not linking the standard "
+            << "library" << std::endl;
+    }
+#if !defined(_WIN32) && !defined(WIN32)
+    // Programs built with --stack run on a thread
+    linkCmd << "-pthread ";
+
+    /*
+     * Modules and std are compiled with a section per function, so this
+     * drops every one the program never reaches, across all of its modules
+     */
+    if(!cliInputs.cBackend) {
+        linkCmd << "-Wl,--gc-sections ";
+    }
+#endif
+    linkCmd << "-lm";
+    {
+        PhaseTimer timer(phaseTimings().linkMs);
+        if(!runCommand(linkCmd.str())) {
+            errorOut("Failed to link objects!");
+        }
+    }
+
+    // Copy final executable
+    const auto copyCmd =
+#if defined(_WIN32) || defined(WIN32)
+        "powershell -command \"copy "
+#else
+        "cp "
+#endif
+        + modInfo.buildFolder + "/" + modInfo.moduleName
+#if defined(_WIN32) || defined(WIN32)
+        + ".exe "
+        + (modInfo.relativeDirectory == "" ? "." : modInfo.relativeDirectory)
+        + "\"";
+#else
+        + " "
+        + (modInfo.relativeDirectory == "" ? "." : modInfo.relativeDirectory);
+#endif
+    if(!runCommand(copyCmd)) {
+        errorOut("Failed to copy output file from build folder to root dir!");
+    }
+}
@@ -6,19 +6,16 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <cstdlib>
 #include <Utility.hpp>
 #include <FileIo.hpp>
+#include <ModuleCache.hpp>
+#include <CodeGen.hpp>
 
 nabd::InputArguments nabd::parseArguments(const int argc, const char **args) {
     InputArguments result;
-    result.link = false;
-    
-    if(argc < 2) {
-        errorOut("No file name provided!\n");
-    }
-    result.fileName = std::string(args[1]);
 
-    for(int i = 2; i < argc; i++) {
+    for(int i = 1; i < argc; i++) {
         if(std::string(args[i]) == "-I" && i + 1 < argc) {
             result.includeFolders.push_back(std::string(args[i + 1]));
             i++;
@@ -30,15 +27,97 @@ nabd::InputArguments nabd::parseArguments(const int argc, const char **args) {
         } else if(std::string(args[i]) == "-l" && i + 1 < argc) {
             result.libraryNames.push_back(std::string(args[i + 1]));
             i++;
+        } else if(std::string(args[i]) == "-o" && i + 1 < argc) {
+            result.outputName = std::string(args[i + 1]);
+            i++;
+        } else if(std::string(args[i]) == "--emit-ninja") {
+            result.emitNinja = true;
+        } else if(std::string(args[i]) == "--translate") {
+            result.translateOnly = true;
+        } else if(std::string(args[i]) == "--anf") {
+            result.anf = true;
+        } else if(std::string(args[i]) == "--backend" && i + 1 < argc) {
+            const auto backend = std::string(args[i + 1]);
+            if(backend != "c" && backend != "cpp") {
+                errorOut("Unknown backend '" + backend + "'!");
+            }
+            result.cBackend = backend == "c";
+            i++;
+        } else if(std::string(args[i]) == "--cc" && i + 1 < argc) {
+            result.cCompiler = std::string(args[i + 1]);
+            i++;
+        } else if(std::string(args[i]) == "--stack" && i + 1 < argc) {
+            const auto megabytes = std::string(args[i + 1]);
+            if(megabytes.find_first_not_of("0123456789") != std::string::npos
+                    || megabytes.length() == 0 || megabytes.length() > 6) {
+                errorOut("Bad stack size '" + megabytes + "'!");
+            }
+            result.stackMegabytes = std::stoul(megabytes);
+            i++;
+        } else if(std::string(args[i]) == "--inline" && i + 1 < argc) {
+            const auto size = std::string(args[i + 1]);
+            if(size.find_first_not_of("0123456789") != std::string::npos
+                    || size.length() == 0 || size.length() > 6) {
+                errorOut("Bad inlining size '" + size + "'!");
+            }
+            result.inlineSize = std::stoul(size);
+            i++;
+        } else if(std::string(args[i]) == "--inline-imports" && i + 1 < argc) {
+            const auto size = std::string(args[i + 1]);
+            if(size.find_first_not_of("0123456789") != std::string::npos
+                    || size.length() == 0 || size.length() > 6) {
+                errorOut("Bad inlining size '" + size + "'!");
+            }
+            result.importInlineSize = std::stoul(size);
+            i++;
+        } else if(std::string(args[i]) == "--memoize" && i + 1 < argc) {
+            const auto entries = std::string(args[i + 1]);
+            if(entries.find_first_not_of("0123456789") != std::string::npos
+                    || entries.length() == 0 || entries.length() > 9) {
+                errorOut("Bad memo table size '" + entries + "'!");
+            }
+            result.memoEntries = std::stoul(entries);
+            i++;
+        } else if(std::string(args[i]) == "--debug") {
+            result.debug = true;
+        } else if(std::string(args[i]) == "--server") {
+            result.serve = true;
+        } else if(std::string(args[i]) == "--watch") {
+            result.watch = true;
+        } else if(std::string(args[i]) == "--socket" && i + 1 < argc) {
+            result.socketPath = std::string(args[i + 1]);
+            i++;
+        } else if(std::string(args[i]) == "--timings" && i + 1 < argc) {
+            result.timingsFile = std::string(args[i + 1]);
+            i++;
+        } else if(result.fileName == "") {
+            // First plain argument is the module (or program when linking)
+            result.fileName = std::string(args[i]);
         } else {
             result.objects.push_back(std::string(args[i]));
         }
     }
 
+    // Lets benchmarks time builds driven by makefiles they can't change
+    const auto envTimings = std::getenv("NABC_TIMINGS");
+    if(result.timingsFile == "" && envTimings != NULL) {
+        result.timingsFile = std::string(envTimings);
+    }
+
+    const auto envCCompiler = std::getenv("NABC_CC");
+    if(result.cCompiler == "") {
+        result.cCompiler =
+            envCCompiler != NULL ? std::string(envCCompiler) : "gcc";
+    }
+
+    if(result.fileName == "" && !result.serve) {
+        errorOut("No file name provided!\n");
+    }
+
     return result;
 }
 
-nabd::ModuleInfo nabd::extractModuleInfo(const nabd::InputArguments &inputs) {
+nabd::ModuleInfo nabd::moduleInfoFor(const nabd::InputArguments &inputs) {
     const auto baseStart = inputs.fileName.find_last_of("/\\");
     const auto baseFileName =
         baseStart != std::string::npos ?
@@ -54,8 +133,8 @@ nabd::ModuleInfo nabd::extractModuleInfo(const nabd::InputArguments &inputs) {
                     || relativeDir.substr(0, 2) == ".\\"
             )) {
         relativeDir = relativeDir.substr(2);
-    } else if(relativeDir.length() > 0 && relativeDir[0] == '.') {
-        relativeDir = relativeDir.substr(1);
+    } else if(relativeDir == ".") {
+        relativeDir = "";
     }
     
     const auto extensionStart = baseFileName.find(".nabd");
@@ -63,7 +142,6 @@ nabd::ModuleInfo nabd::extractModuleInfo(const nabd::InputArguments &inputs) {
         extensionStart != std::string::npos ?
             baseFileName.substr(0, extensionStart) :
             baseFileName;
-    std::cout << "Building module '" << moduleName << '\'' << std::endl;
 
     const auto buildFolder =
         (relativeDir != "" ? (relativeDir + "/") : "")
@@ -75,8 +153,63 @@ nabd::ModuleInfo nabd::extractModuleInfo(const nabd::InputArguments &inputs) {
     };
 }
 
+nabd::ModuleInfo nabd::extractModuleInfo(const nabd::InputArguments &inputs) {
+    const auto modInfo = moduleInfoFor(inputs);
+    logOut() << "Building module '" << modInfo.moduleName << '\'' << std::endl;
+    return modInfo;
+}
+
+nabd::ModuleLocation nabd::findModule(
+        const std::string &ident, const InputArguments &inputs) {
+    for(const auto &folder : inputs.includeFolders) {
+        logOut()
+            << "Checking for module '" << ident << "' in folder '"
+            << folder << '\'' << std::endl;
+
+        // Check for C++ code
+        const auto hppFileName =
+            (folder != "" ? (folder + "/") : "") + ident + ".hpp";
+        logOut() << "Checking for '" << hppFileName << "'..." << std::endl;
+        if(moduleFileExists(folder, ident + ".hpp")) {
+            return { hppFileName, true };
+        }
+
+        // Check for nabd code
+        const auto nabdFileName =
+            (folder != "" ? (folder + "/") : "") + ident + ".nabd";
+        logOut() << "Checking for '" << nabdFileName << "'..." << std::endl;
+        if(moduleFileExists(folder, ident + ".nabd")) {
+            return { nabdFileName, false };
+        }
+    }
+
+    errorOut("Can't find included module '" + ident + "'!");
+    return { "", false };
+}
+
+const std::string g_stdLibFileName = "libnabdstd.a";
+
+std::string nabd::findStdLibFolder(const InputArguments &inputs) {
+    auto folders = inputs.linkFolders;
+    const auto exeDir = getExecutableDir();
+    if(exeDir != "") {
+        folders.push_back(exeDir);
+        folders.push_back(exeDir + "/../lib");
+    }
+    for(const auto &folder : folders) {
+        std::ifstream lib(
+            (folder != "" ? (folder + "/") : "") + g_stdLibFileName
+        );
+        if(lib.is_open()) {
+            return folder != "" ? folder : ".";
+        }
+    }
+    return "";
+}
+
 std::string nabd::generateMakefile(
-        const InputArguments &inputs, const ModuleInfo &modInfo) {
+        const InputArguments &inputs, const ModuleInfo &modInfo,
+        const std::vector<std::string> &shardNames) {
     std::stringstream inc;
     for(const auto &folder : inputs.includeFolders) {
         if((folder.length() > 0 && folder[0] == '/')
@@ -89,9 +222,38 @@ std::string nabd::generateMakefile(
         }
     }
     inc << "\"-I" << getCurrentDir() << "/" << modInfo.buildFolder << "\" ";
+
+    std::stringstream src;
+    for(const auto &shard : shardNames) {
+        src << shard << codegen::sourceExtension(inputs) << " ";
+    }
+
+    // C modules are never sharded
+    if(inputs.cBackend) {
+        auto makeFileTemplateCp = g_cMakeFile;
+        makeFileTemplateCp[1] = src.str();
+        makeFileTemplateCp[3] = modInfo.moduleName + ".o";
+        makeFileTemplateCp[5] = inputs.cCompiler;
+        makeFileTemplateCp[7] = cCompileFlags(inputs);
+        makeFileTemplateCp[9] = inc.str();
+
+        std::stringstream makeFile;
+        for(const auto &section : makeFileTemplateCp) {
+            makeFile << section;
+        }
+        return makeFile.str();
+    }
     
     auto makeFileTemplateCp = g_makeFile;
-    makeFileTemplateCp[1] = inc.str();
+    makeFileTemplateCp[1] = src.str();
+    makeFileTemplateCp[3] = modInfo.moduleName + ".o";
+    makeFileTemplateCp[5] = inc.str();
+    if(shardNames.size() > 1) {
+        // Shards are combined into one relocatable object for the module
+        makeFileTemplateCp[7] =
+            "$(OBJNAME) : $(SHARD_OBJS)\n"
+            "\t$(LD) -r -o $@ $^\n";
+    }
 
     std::stringstream makeFile;
     for(const auto &section : makeFileTemplateCp) {
@@ -102,17 +264,25 @@ std::string nabd::generateMakefile(
 }
 
 const std::vector<std::string> nabd::g_makeFile = {
-    "SRC_FILE :=\t\t\t$(wildcard *.cpp)\n"
-    "OBJNAME :=\t\t\t$(subst .cpp,.o,$(SRC_FILE))\n"
+    "SRC_FILE :=\t\t\t",
+    "", // Insert shard source files
+    "\nOBJNAME :=\t\t\t",
+    "", // Insert module object file
+    "\n"
+    "SHARD_OBJS :=\t\t$(subst .cpp,.o,$(SRC_FILE))\n"
     "CPPC :=\t\t\t\tg++\n"
-    "CPPFLAGS :=\t\t\t-O2 -Wall -Werror -std=c++17\n"
+    "LD :=\t\t\t\tld\n"
+    "CPPFLAGS :=\t\t\t-O2 -Wall -Werror -std=c++17 -MMD "
+    "-ffunction-sections -fdata-sections\n"
     "INC :=\t\t\t\t",
     "", // Insert include folders
     "\n"
     ".PHONY : all\n"
     "all : $(OBJNAME)\n"
-    "$(OBJNAME) : $(SRC_FILE)\n"
+    "%.o : %.cpp Makefile\n"
     "\t$(CPPC) $(INC) $(CPPFLAGS) -c $< -o $@\n"
+    "-include $(subst .cpp,.d,$(SRC_FILE))\n",
+    "" // Insert combining the shards
 };
 
 const std::string nabd::g_varHpp =
@@ -121,6 +291,8 @@ const std::string nabd::g_varHpp =
     "#include <utility>\n"
     "#include <vector>\n"
     "#include <memory>\n"
+    "#include <list>\n"
+    "#include <unordered_map>\n"
     "enum class VariableType { String, Number, List, Tuple };\n"
     "struct Variable {\n"
     "    virtual std::shared_ptr<Variable> toString(void) const = 0;\n"
@@ -151,6 +323,14 @@ const std::string nabd::g_varHpp =
     "    VariablePointer toTuple(void) const override;\n"
     "    const double value;\n"
     "};\n"
+    "inline double numberValue(const VariablePointer &var) {\n"
+    "    const auto num = dynamic_cast<const NumberVariable *>(var.get());\n"
+    "    return num != nullptr ?\n"
+    "        num->value :\n"
+    "        std::dynamic_pointer_cast<NumberVariable>(\n"
+    "            var->toNumber()\n"
+    "        )->value;\n"
+    "}\n"
     "struct ListVariable : public Variable {\n"
     "    ListVariable(const std::vector<VariablePointer> &data);\n"
     "    VariablePointer toString(void) const override;\n"
@@ -159,7 +339,7 @@ const std::string nabd::g_varHpp =
     "        const std::vector<VariableType> &subTypes\n"
     "    ) const override;\n"
     "    VariablePointer toTuple(void) const override;\n"
-    "    const std::vector<VariablePointer> values;\n"
+    "    std::vector<VariablePointer> values;\n"
     "};\n"
     "struct TupleVariable : public Variable {\n"
     "    TupleVariable(\n"
@@ -171,7 +351,36 @@ const std::string nabd::g_varHpp =
     "        const std::vector<VariableType> &subTypes\n"
     "    ) const override;\n"
     "    VariablePointer toTuple(void) const override;\n"
-    "    const std::pair<VariablePointer, VariablePointer> values;\n"
+    "    std::pair<VariablePointer, VariablePointer> values;\n"
+    "};\n"
+    "size_t variableHash(const VariablePointer &var);\n"
+    "bool variablesEqual(\n"
+    "    const VariablePointer &left, const VariablePointer &right\n"
+    ");\n"
+    "struct MemoTable {\n"
+    "    MemoTable(const char *funcName, const size_t capacity);\n"
+    "    ~MemoTable(void);\n"
+    "    bool find(const VariablePointer &arg, VariablePointer &result);\n"
+    "    void insert(\n"
+    "        const VariablePointer &arg, const VariablePointer &result\n"
+    "    );\n"
+    "    struct KeyHash {\n"
+    "        size_t operator()(const VariablePointer &var) const;\n"
+    "    };\n"
+    "    struct KeyEqual {\n"
+    "        bool operator()(\n"
+    "            const VariablePointer &left, const VariablePointer &right\n"
+    "        ) const;\n"
+    "    };\n"
+    "    typedef std::list<std::pair<VariablePointer, VariablePointer>>\n"
+    "        Entries;\n"
+    "    const char *funcName;\n"
+    "    const size_t capacity;\n"
+    "    Entries entries;\n"
+    "    std::unordered_map<\n"
+    "        VariablePointer, Entries::iterator, KeyHash, KeyEqual\n"
+    "    > byArg;\n"
+    "    size_t hits, misses, evictions;\n"
     "};\n";
 
 const std::string nabd::g_varCpp =
@@ -180,6 +389,10 @@ const std::string nabd::g_varCpp =
     "#include <sstream>\n"
     "#include <vector>\n"
     "#include <memory>\n"
+    "#include <list>\n"
+    "#include <unordered_map>\n"
+    "#include <functional>\n"
+    "#include <cstdio>\n"
     "#include <Variable.hpp>\n"
     "VariablePointer listHelper(\n"
     "        VariablePointer self,\n"
@@ -298,12 +511,12 @@ const std::string nabd::g_varCpp =
     "VariablePointer ListVariable::toString(void) const {\n"
     "    std::stringstream listStr;\n"
     "    listStr << \"{\";\n"
-    "    for(const auto value : values) {\n"
+    "    for(size_t i = 0; i < values.size(); i++) {\n"
     "        listStr <<\n"
     "            std::dynamic_pointer_cast<StringVariable>(\n"
-    "                value->toString()\n"
+    "                values[i]->toString()\n"
     "            )->value;\n"
-    "        if(value != *(values.begin())) {\n"
+    "        if(i > 0) {\n"
     "            listStr << \", \";\n"
     "        }\n"
     "    }\n"
@@ -325,4 +538,113 @@ const std::string nabd::g_varCpp =
     "        std::make_shared<ListVariable>(values),\n"
     "        std::make_shared<ListVariable>(values)\n"
     "    ));\n"
+    "}\n"
+    "size_t variableHash(const VariablePointer &var) {\n"
+    "    const auto combine = [](const size_t seed, const size_t hash) {\n"
+    "        return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));\n"
+    "    };\n"
+    "    const auto str = dynamic_cast<const StringVariable *>(var.get());\n"
+    "    const auto num = dynamic_cast<const NumberVariable *>(var.get());\n"
+    "    const auto tup = dynamic_cast<const TupleVariable *>(var.get());\n"
+    "    const auto list = dynamic_cast<const ListVariable *>(var.get());\n"
+    "    if(str != nullptr) {\n"
+    "        return combine(1, std::hash<std::string>()(str->value));\n"
+    "    } else if(num != nullptr) {\n"
+    "        return combine(2, std::hash<double>()(num->value + 0.0));\n"
+    "    } else if(tup != nullptr) {\n"
+    "        return combine(\n"
+    "            combine(3, variableHash(tup->values.first)),\n"
+    "            variableHash(tup->values.second)\n"
+    "        );\n"
+    "    }\n"
+    "    size_t hash = 4;\n"
+    "    for(const auto &item : list->values) {\n"
+    "        hash = combine(hash, variableHash(item));\n"
+    "    }\n"
+    "    return hash;\n"
+    "}\n"
+    "bool variablesEqual(\n"
+    "        const VariablePointer &left, const VariablePointer &right) {\n"
+    "    if(left == right) {\n"
+    "        return true;\n"
+    "    }\n"
+    "    const auto str = dynamic_cast<const StringVariable *>(left.get());\n"
+    "    const auto num = dynamic_cast<const NumberVariable *>(left.get());\n"
+    "    const auto tup = dynamic_cast<const TupleVariable *>(left.get());\n"
+    "    const auto list = dynamic_cast<const ListVariable *>(left.get());\n"
+    "    if(str != nullptr) {\n"
+    "        const auto other =\n"
+    "            dynamic_cast<const StringVariable *>(right.get());\n"
+    "        return other != nullptr && other->value == str->value;\n"
+    "    } else if(num != nullptr) {\n"
+    "        const auto other =\n"
+    "            dynamic_cast<const NumberVariable *>(right.get());\n"
+    "        return other != nullptr && other->value == num->value;\n"
+    "    } else if(tup != nullptr) {\n"
+    "        const auto other =\n"
+    "            dynamic_cast<const TupleVariable *>(right.get());\n"
+    "        return other != nullptr\n"
+    "            && variablesEqual(tup->values.first, other->values.first)\n"
+    "            && variablesEqual(\n"
+    "                tup->values.second, other->values.second\n"
+    "            );\n"
+    "    }\n"
+    "    const auto other = dynamic_cast<const ListVariable *>(right.get());\n"
+    "    if(other == nullptr\n"
+    "            || other->values.size() != list->values.size()) {\n"
+    "        return false;\n"
+    "    }\n"
+    "    for(size_t i = 0; i < list->values.size(); i++) {\n"
+    "        if(!variablesEqual(list->values[i], other->values[i])) {\n"
+    "            return false;\n"
+    "        }\n"
+    "    }\n"
+    "    return true;\n"
+    "}\n"
+    "size_t MemoTable::KeyHash::operator()(\n"
+    "        const VariablePointer &var) const {\n"
+    "    return variableHash(var);\n"
+    "}\n"
+    "bool MemoTable::KeyEqual::operator()(\n"
+    "        const VariablePointer &left,\n"
+    "        const VariablePointer &right) const {\n"
+    "    return variablesEqual(left, right);\n"
+    "}\n"
+    "MemoTable::MemoTable(const char *name, const size_t maxEntries) :\n"
+    "        funcName(name), capacity(maxEntries), hits(0), misses(0),\n"
+    "        evictions(0) {\n"
+    "}\n"
+    "MemoTable::~MemoTable(void) {\n"
+    "    if(hits + misses > 0) {\n"
+    "        std::fprintf(\n"
+    "            stderr,\n"
+    "            \"Memoized '%s': %zu hits, %zu misses, %zu evicted\\n\",\n"
+    "            funcName, hits, misses, evictions\n"
+    "        );\n"
+    "    }\n"
+    "}\n"
+    "bool MemoTable::find(\n"
+    "        const VariablePointer &arg, VariablePointer &result) {\n"
+    "    const auto entry = byArg.find(arg);\n"
+    "    if(entry == byArg.end()) {\n"
+    "        misses++;\n"
+    "        return false;\n"
+    "    }\n"
+    "    hits++;\n"
+    "    entries.splice(entries.begin(), entries, entry->second);\n"
+    "    result = entry->second->second;\n"
+    "    return true;\n"
+    "}\n"
+    "void MemoTable::insert(\n"
+    "        const VariablePointer &arg, const VariablePointer &result) {\n"
+    "    if(capacity == 0 || byArg.count(arg) > 0) {\n"
+    "        return;\n"
+    "    }\n"
+    "    if(entries.size() >= capacity) {\n"
+    "        byArg.erase(entries.back().first);\n"
+    "        entries.pop_back();\n"
+    "        evictions++;\n"
+    "    }\n"
+    "    entries.push_front({ arg, result });\n"
+    "    byArg[arg] = entries.begin();\n"
     "}\n";
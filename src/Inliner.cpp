@@ -0,0 +1,358 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of inlining small functions
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <ModuleCache.hpp>
+#include <TypeInfer.hpp>
+#include <TailCalls.hpp>
+#include <ConstFold.hpp>
+#include <Inliner.hpp>
+
+using namespace nabd;
+using namespace nabd::inlining;
+
+Token asExpr(const Token &subExpr) {
+    return {
+        TokenType::Expr, "", subExpr.line, subExpr.col,
+        std::vector<Token>({ subExpr })
+    };
+}
+
+// A call's callee and a Let's name are identifiers, but not uses of one
+size_t firstValueChild(const Token &tok) {
+    return tok.type == TokenType::FuncCall || tok.type == TokenType::Let ?
+        1 : 0;
+}
+
+Token inlining::substitute(
+        const Token &expr, const std::string &name, const Token &value) {
+    if(expr.type == TokenType::Identifier) {
+        return expr.value == name ? value : expr;
+    } else if(expr.type == TokenType::Expr
+            && expr.children[0].type == TokenType::Identifier) {
+        if(expr.children[0].value != name) {
+            return expr;
+        }
+        return value.type == TokenType::Expr ? value : asExpr(value);
+    }
+    auto result = expr;
+    for(size_t i = firstValueChild(expr); i < expr.children.size(); i++) {
+        result.children[i] = substitute(expr.children[i], name, value);
+    }
+    return result;
+}
+
+size_t inlining::countUses(const Token &expr, const std::string &name) {
+    if(expr.type == TokenType::Identifier) {
+        return expr.value == name ? 1 : 0;
+    }
+    size_t uses = 0;
+    for(size_t i = firstValueChild(expr); i < expr.children.size(); i++) {
+        uses += countUses(expr.children[i], name);
+    }
+    return uses;
+}
+
+// Calls, literals, names and so on in tok (but not punctuation)
+size_t exprSize(const Token &tok) {
+    size_t size = 0;
+    switch(tok.type) {
+        case TokenType::FuncCall:
+        case TokenType::Ternary:
+        case TokenType::ListDef:
+        case TokenType::TupDef:
+        case TokenType::Let:
+        case TokenType::Decimal:
+        case TokenType::Hex:
+        case TokenType::String:
+        case TokenType::Identifier:
+            size = 1;
+            break;
+
+        default:
+            break;
+    }
+    for(const auto &child : tok.children) {
+        size += exprSize(child);
+    }
+    return size;
+}
+
+void collectNames(const Token &tok, std::vector<std::string> &names) {
+    if(tok.type == TokenType::Identifier) {
+        names.push_back(tok.value);
+    }
+    for(const auto &child : tok.children) {
+        collectNames(child, names);
+    }
+}
+
+std::string inlining::letPrefix(
+        const Token &program, const std::string &start) {
+    std::vector<std::string> names;
+    collectNames(program, names);
+    auto prefix = start;
+    bool clashes = true;
+    while(clashes) {
+        clashes = false;
+        for(const auto &name : names) {
+            if(name.compare(0, prefix.length(), prefix) == 0) {
+                clashes = true;
+                prefix += "_";
+                break;
+            }
+        }
+    }
+    return prefix;
+}
+
+void collectCalls(
+        const Token &tok, const types::TypeContext &ctx,
+        const std::map<std::string, size_t> &funcInds,
+        std::vector<size_t> &callees) {
+    if(tok.type == TokenType::FuncCall && !types::isStdCall(tok, ctx)) {
+        const auto callee = funcInds.find(tok.children[0].value);
+        if(callee != funcInds.end()) {
+            callees.push_back(callee->second);
+        }
+    }
+    for(const auto &child : tok.children) {
+        collectCalls(child, ctx, funcInds, callees);
+    }
+}
+
+struct Inliner {
+    const types::TypeContext &ctx;
+    std::string prefix;
+    size_t nextTemp;
+
+    // Functions small enough to inline, as their parameter and body
+    std::map<std::string, std::pair<std::string, Token>> small;
+
+    Token inlineInto(const Token &tok) {
+        auto result = tok;
+        for(auto &child : result.children) {
+            child = inlineInto(child);
+        }
+        if(result.type != TokenType::Expr
+                || result.children[0].type != TokenType::FuncCall
+                || types::isStdCall(result.children[0], ctx)) {
+            return result;
+        }
+        const auto &funcCall = result.children[0];
+        const auto func = small.find(funcCall.children[0].value);
+        if(func == small.end()) {
+            return result;
+        }
+        return inlineCall(func->second.first, func->second.second, funcCall);
+    }
+
+    Token tempName(const Token &at) {
+        return {
+            TokenType::Identifier, prefix + std::to_string(nextTemp++),
+            at.line, at.col, std::vector<Token>()
+        };
+    }
+
+    // Each copy of a body gets its own temporaries, so they can't clash
+    Token freshLets(const Token &tok) {
+        auto result = tok;
+        for(auto &child : result.children) {
+            child = freshLets(child);
+        }
+        if(result.type == TokenType::Let) {
+            const auto name = tempName(result);
+            result.children[2] = substitute(
+                result.children[2], result.children[0].value, name
+            );
+            result.children[0] = name;
+        }
+        return result;
+    }
+
+    /*
+     * Names and literals are fine to repeat, and a pure argument used once
+     * can be worked out where it's used instead of first. Anything else
+     * still has to be worked out (once) before the body
+     */
+    Token inlineCall(
+            const std::string &param, const Token &body,
+            const Token &funcCall) {
+        const auto &arg = funcCall.children[2];
+        const auto &argExpr =
+            arg.type == TokenType::Identifier ? arg : arg.children[0];
+        const auto isAtom = argExpr.type == TokenType::Identifier
+            || argExpr.type == TokenType::Decimal
+            || argExpr.type == TokenType::Hex
+            || argExpr.type == TokenType::String;
+        const auto copy = freshLets(body);
+        if(isAtom || (
+                countUses(copy, param) <= 1 && folding::isPure(arg, ctx))) {
+            return substitute(copy, param, arg);
+        }
+
+        const auto name = tempName(funcCall);
+        const Token let = {
+            TokenType::Let, "", funcCall.line, funcCall.col,
+            std::vector<Token>({
+                name,
+                arg.type == TokenType::Expr ? arg : asExpr(arg),
+                substitute(copy, param, name)
+            })
+        };
+        return asExpr(let);
+    }
+};
+
+std::vector<Token> inlining::exportedInlines(
+        const Token &module, const InputArguments &cliInputs,
+        const size_t maxSize) {
+    std::vector<Token> funcDefs;
+    if(maxSize == 0) {
+        return funcDefs;
+    }
+    const auto ctx = types::moduleTypeContext(module, cliInputs);
+    for(const auto &topLevelTok : module.children) {
+        if(topLevelTok.type == TokenType::FuncDef
+                && topLevelTok.children[0].value != "main"
+                && exprSize(topLevelTok.children[4]) <= maxSize
+                && folding::isPure(topLevelTok.children[4], ctx)) {
+            funcDefs.push_back(topLevelTok);
+        }
+    }
+    return funcDefs;
+}
+
+// Types and values only, so moving a definition doesn't change the hash
+void hashToken(const Token &tok, uint64_t &hash) {
+    const auto mix = [&hash](const uint8_t byte) {
+        hash = (hash ^ byte) * 0x100000001b3ull; // FNV-1a
+    };
+    mix(static_cast<uint8_t>(tok.type));
+    for(const auto c : tok.value) {
+        mix(static_cast<uint8_t>(c));
+    }
+    mix(0);
+    for(const auto &child : tok.children) {
+        hashToken(child, hash);
+    }
+    mix(0xFF);
+}
+
+std::string inlining::interfaceHash(const std::vector<Token> &funcDefs) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for(const auto &funcDef : funcDefs) {
+        hashToken(funcDef, hash);
+    }
+    std::stringstream hex;
+    hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return hex.str();
+}
+
+/*
+ * Exported inlines of the nabd modules program includes. Their std calls
+ * have to be std calls here too, so program must include std itself and
+ * not define functions of the same names
+ */
+void addImportedInlines(
+        const Token &program, const types::TypeContext &ctx,
+        const InputArguments &cliInputs,
+        std::map<std::string, std::pair<std::string, Token>> &small) {
+    std::vector<std::string> ownNames;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            ownNames.push_back(topLevelTok.children[0].value);
+        }
+    }
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type != TokenType::Include) {
+            continue;
+        }
+        ModuleLocation location;
+        try {
+            location = findModule(topLevelTok.children[1].value, cliInputs);
+        } catch(const CompileError &) {
+            continue;
+        }
+        if(location.isCpp) {
+            continue;
+        }
+        const auto included = loadModule(location.fileName);
+        for(const auto &funcDef : exportedInlines(
+                *included, cliInputs, cliInputs.importInlineSize)) {
+            const auto &name = funcDef.children[0].value;
+            if(folding::isPure(funcDef.children[4], ctx)
+                    && std::find(ownNames.begin(), ownNames.end(), name)
+                        == ownNames.end()) {
+                small[name] = {
+                    funcDef.children[2].value, funcDef.children[4]
+                };
+            }
+        }
+    }
+}
+
+Token inlining::inlineCalls(
+        const Token &program, const types::TypeContext &ctx,
+        const InputArguments &cliInputs) {
+    const auto maxSize = cliInputs.inlineSize;
+    if(maxSize == 0 && cliInputs.importInlineSize == 0) {
+        return program;
+    }
+
+    std::vector<size_t> funcDefInds;
+    std::map<std::string, size_t> funcInds;
+    for(size_t i = 0; i < program.children.size(); i++) {
+        if(program.children[i].type == TokenType::FuncDef) {
+            funcInds[program.children[i].children[0].value] =
+                funcDefInds.size();
+            funcDefInds.push_back(i);
+        }
+    }
+    std::vector<std::vector<size_t>> edges(funcDefInds.size());
+    for(size_t i = 0; i < funcDefInds.size(); i++) {
+        collectCalls(
+            program.children[funcDefInds[i]].children[4], ctx, funcInds,
+            edges[i]
+        );
+    }
+
+    // Callees come first, so they're already inlined into when it's used
+    auto inlined = program;
+    Inliner inliner = {
+        ctx, letPrefix(program, "v"), 0,
+        std::map<std::string, std::pair<std::string, Token>>()
+    };
+    addImportedInlines(program, ctx, cliInputs, inliner.small);
+    for(const auto &component : tailcalls::stronglyConnected(edges)) {
+        const auto recursive = component.size() > 1
+            || std::find(
+                edges[component[0]].begin(), edges[component[0]].end(),
+                component[0]
+            ) != edges[component[0]].end();
+        for(const auto func : component) {
+            auto &funcDef = inlined.children[funcDefInds[func]];
+            funcDef.children[4] = inliner.inlineInto(funcDef.children[4]);
+            const auto &name = funcDef.children[0].value;
+            if(!recursive && name != "main"
+                    && exprSize(funcDef.children[4]) <= maxSize) {
+                inliner.small[name] = {
+                    funcDef.children[2].value, funcDef.children[4]
+                };
+            }
+        }
+    }
+    return inlined;
+}
@@ -0,0 +1,133 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the parsed module and include folder caches
+ */
+
+#include <string>
+#include <memory>
+#include <map>
+#include <set>
+#include <mutex>
+#include <fstream>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <Parser.hpp>
+#include <ModuleCache.hpp>
+#include <Timing.hpp>
+
+#if !defined(_WIN32) && !defined(WIN32)
+#include <dirent.h>
+#endif
+
+using namespace nabd;
+
+struct FileStamp {
+    bool operator==(const FileStamp &other) const {
+        return exists == other.exists && size == other.size
+            && mtimeSec == other.mtimeSec && mtimeNsec == other.mtimeNsec;
+    }
+
+    bool exists;
+    long long size, mtimeSec, mtimeNsec;
+};
+
+struct CachedModule {
+    FileStamp stamp;
+    std::shared_ptr<const Token> program;
+};
+
+struct CachedFolder {
+    FileStamp stamp;
+    std::set<std::string> files;
+};
+
+// Builds can run on several threads at once, so guard both caches
+std::mutex g_cacheMutex;
+std::map<std::string, CachedModule> g_moduleCache;
+std::map<std::string, CachedFolder> g_folderCache;
+
+FileStamp getFileStamp(const std::string &name) {
+    struct stat st;
+    if(stat(name.c_str(), &st) != 0) {
+        return { false, 0, 0, 0 };
+    }
+#if defined(_WIN32) || defined(WIN32) || defined(__APPLE__)
+    return {
+        true, static_cast<long long>(st.st_size),
+        static_cast<long long>(st.st_mtime), 0
+    };
+#else
+    return {
+        true, static_cast<long long>(st.st_size),
+        static_cast<long long>(st.st_mtim.tv_sec),
+        static_cast<long long>(st.st_mtim.tv_nsec)
+    };
+#endif
+}
+
+std::shared_ptr<const Token> nabd::loadModule(const std::string &fileName) {
+    const auto fullPath = getFullPath(fileName);
+    const auto stamp = getFileStamp(fullPath);
+
+    {
+        std::lock_guard<std::mutex> lock(g_cacheMutex);
+        const auto cached = g_moduleCache.find(fullPath);
+        if(cached != g_moduleCache.end() && cached->second.stamp == stamp) {
+            return cached->second.program;
+        }
+    }
+
+    // Parse outside of the lock so other modules can be parsed meanwhile
+    std::shared_ptr<const Token> program;
+    try {
+        PhaseTimer timer(phaseTimings().parseMs);
+        const auto code = readFile(fileName);
+        program = std::make_shared<const Token>(
+            parser::parseProgram(code, 0, 1, 1).result
+        );
+    } catch(CompileError &e) {
+        if(e.fileName == "") {
+            e.fileName = fileName;
+        }
+        throw;
+    }
+
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_moduleCache[fullPath] = { stamp, program };
+    return program;
+}
+
+bool nabd::moduleFileExists(
+        const std::string &folder, const std::string &fileName) {
+#if defined(_WIN32) || defined(WIN32)
+    std::ifstream file((folder != "" ? (folder + "/") : "") + fileName);
+    return file.is_open();
+#else
+    const auto fullPath = getFullPath(folder);
+    const auto stamp = getFileStamp(fullPath);
+
+    // Adding or removing a file changes the folder's timestamp
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    auto cached = g_folderCache.find(fullPath);
+    if(cached == g_folderCache.end() || !(cached->second.stamp == stamp)) {
+        CachedFolder listing = { stamp, std::set<std::string>() };
+        auto dir = opendir(fullPath.c_str());
+        if(dir != NULL) {
+            auto entry = readdir(dir);
+            while(entry != NULL) {
+                listing.files.insert(std::string(entry->d_name));
+                entry = readdir(dir);
+            }
+            closedir(dir);
+        }
+        cached = g_folderCache.insert_or_assign(fullPath, listing).first;
+    }
+    return cached->second.files.count(fileName) > 0;
+#endif
+}
+
+void nabd::clearModuleCache(void) {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_moduleCache.clear();
+    g_folderCache.clear();
+}
@@ -0,0 +1,150 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the library interface to the compiler
+ */
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <memory>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <Parser.hpp>
+#include <FileIo.hpp>
+#include <ModuleCache.hpp>
+#include <CodeGen.hpp>
+#include <Driver.hpp>
+#include <Nabd.hpp>
+
+using namespace nabd;
+
+// Sends this thread's log to a stream until it goes out of scope
+struct LogCapture {
+    LogCapture(std::ostream &stream) : previous(logStream()) {
+        logStream() = &stream;
+    }
+
+    ~LogCapture(void) {
+        logStream() = previous;
+    }
+
+    std::ostream *previous;
+};
+
+// Runs one step of a build, turning a CompileError into a diagnostic
+template<typename Stage>
+bool runStage(
+        CompileResult &result, const CompileStatus failStatus,
+        const std::string &fileName, Stage stage) {
+    try {
+        stage();
+        return true;
+    } catch(const CompileError &e) {
+        result.status = failStatus;
+        result.diagnostics.push_back({
+            e.fileName != "" ? e.fileName : fileName,
+            e.line, e.col, e.what()
+        });
+        return false;
+    }
+}
+
+// Sharded modules are handed back as one listing, file by file
+std::string joinShards(
+        const codegen::ModuleCode &code, const ModuleInfo &modInfo) {
+    if(code.shards.size() == 1) {
+        return code.shards[0];
+    }
+    std::stringstream joined;
+    joined
+        << "// " << codegen::declarationsName(modInfo) << "\n"
+        << code.declarations;
+    for(size_t i = 0; i < code.shards.size(); i++) {
+        joined
+            << "\n// " << codegen::shardName(modInfo, i, code.shards.size())
+            << ".cpp\n" << code.shards[i];
+    }
+    return joined.str();
+}
+
+CompileResult nabd::compileSource(
+        const std::string &code, const InputArguments &inputs) {
+    CompileResult result = { CompileStatus::Success, { }, "", "" };
+    std::stringstream log;
+    {
+        LogCapture capture(log);
+        auto moduleInputs = inputs;
+        const auto modInfo = extractModuleInfo(moduleInputs);
+        moduleInputs.includeFolders.push_back(modInfo.relativeDirectory);
+
+        Token program;
+        if(runStage(
+                result, CompileStatus::ParseError, inputs.fileName, [&]() {
+                    program = parser::parseProgram(code, 0, 1, 1).result;
+                })) {
+            runStage(
+                result, CompileStatus::CodeGenError, inputs.fileName, [&]() {
+                    result.cppCode = codegen::generateCppCode(
+                        program, moduleInputs, modInfo
+                    );
+                }
+            );
+        }
+    }
+    result.log = log.str();
+    return result;
+}
+
+CompileResult nabd::compileModule(const InputArguments &inputs) {
+    CompileResult result = { CompileStatus::Success, { }, "", "" };
+    std::stringstream log;
+    {
+        LogCapture capture(log);
+        auto moduleInputs = inputs;
+        const auto modInfo = extractModuleInfo(moduleInputs);
+        moduleInputs.includeFolders.push_back(modInfo.relativeDirectory);
+
+        std::shared_ptr<const Token> program;
+        codegen::ModuleCode code;
+        const auto parsed = runStage(
+            result, CompileStatus::ParseError, inputs.fileName, [&]() {
+                program = loadModule(modInfo.fileName);
+            }
+        );
+        const auto generated = parsed && runStage(
+            result, CompileStatus::CodeGenError, inputs.fileName, [&]() {
+                code = compile(*program, moduleInputs, modInfo);
+                result.cppCode = joinShards(code, modInfo);
+            }
+        );
+        if(generated) {
+            runStage(
+                result, CompileStatus::BuildError, inputs.fileName, [&]() {
+                    if(moduleInputs.translateOnly) {
+                        translate(
+                            *program, code, moduleInputs, modInfo
+                        );
+                    } else {
+                        buildObj(code, moduleInputs, modInfo);
+                    }
+                }
+            );
+        }
+    }
+    result.log = log.str();
+    return result;
+}
+
+CompileResult nabd::linkProgram(const InputArguments &inputs) {
+    CompileResult result = { CompileStatus::Success, { }, "", "" };
+    std::stringstream log;
+    {
+        LogCapture capture(log);
+        const auto modInfo = extractModuleInfo(inputs);
+        runStage(result, CompileStatus::BuildError, inputs.fileName, [&]() {
+            link(inputs, modInfo);
+        });
+    }
+    result.log = log.str();
+    return result;
+}
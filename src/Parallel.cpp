@@ -0,0 +1,67 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the parallel for loop
+ */
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <vector>
+#include <algorithm>
+#include <Parallel.hpp>
+
+using namespace nabd;
+
+void nabd::parallelFor(
+        const size_t count, const std::function<void(size_t)> &task,
+        const size_t minPerThread) {
+    const auto maxThreads = std::max<size_t>(
+        1, std::thread::hardware_concurrency()
+    );
+    const auto numThreads = std::min(
+        maxThreads, count / std::max<size_t>(1, minPerThread)
+    );
+    if(numThreads <= 1) {
+        for(size_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    // Tasks can take very different amounts of time, so hand them out 1 by 1
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    const auto worker = [&]() {
+        size_t i;
+        while(!failed && (i = next++) < count) {
+            try {
+                task(i);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if(!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    // The calling thread does its share of the work too
+    std::vector<std::thread> threads;
+    for(size_t i = 1; i < numThreads; i++) {
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for(auto &thread : threads) {
+        thread.join();
+    }
+
+    if(error) {
+        std::rethrow_exception(error);
+    }
+}
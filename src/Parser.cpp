@@ -47,7 +47,8 @@ parser::ParserResult parser::parseProgram(
         errorOut(
             std::string("Could not parse include or func def on ln ")
                 + std::to_string(isFuncDef.newLine) + std::string(", col ")
-                + std::to_string(isFuncDef.newCol)
+                + std::to_string(isFuncDef.newCol),
+            isFuncDef.newLine, isFuncDef.newCol
         );
     }
     return {
@@ -0,0 +1,305 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of lowering thrown away values to sequences
+ */
+
+#include <string>
+#include <vector>
+#include <set>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+#include <ConstFold.hpp>
+#include <Inliner.hpp>
+#include <Sequencing.hpp>
+
+using namespace nabd;
+
+Token seqExpr(const Token &subExpr) {
+    return {
+        TokenType::Expr, "", subExpr.line, subExpr.col,
+        std::vector<Token>({ subExpr })
+    };
+}
+
+const Token &seqSubExpr(const Token &expr) {
+    return expr.type == TokenType::Identifier ? expr : expr.children[0];
+}
+
+// The items of a list or tuple literal, skipping the punctuation
+std::vector<Token> literalItems(const Token &literal) {
+    std::vector<Token> items;
+    for(size_t i = 1; i + 1 < literal.children.size(); i += 2) {
+        items.push_back(literal.children[i]);
+    }
+    return items;
+}
+
+/*
+ * If expr is fst or snd of a tuple literal, which (0 or 1) of the tuple's
+ * items it gives back
+ */
+bool projectsLiteral(
+        const Token &expr, const types::TypeContext &ctx, size_t &kept) {
+    const auto &subExpr = seqSubExpr(expr);
+    if(subExpr.type != TokenType::FuncCall
+            || !types::isStdCall(subExpr, ctx)
+            || seqSubExpr(subExpr.children[2]).type != TokenType::TupDef) {
+        return false;
+    }
+    const auto &callee = subExpr.children[0].value;
+    if(callee != "fst" && callee != "snd") {
+        return false;
+    }
+    kept = callee == "fst" ? 0 : 1;
+    return true;
+}
+
+// Whether each part of expr has its value used, for finding unused results
+void markUses(
+        const Token &expr, const bool discarded,
+        const types::TypeContext &ctx, std::set<std::string> &used) {
+    const auto &subExpr = seqSubExpr(expr);
+    size_t kept;
+    if(projectsLiteral(expr, ctx, kept)) {
+        const auto items = literalItems(seqSubExpr(subExpr.children[2]));
+        markUses(items[kept], discarded, ctx, used);
+        markUses(items[1 - kept], true, ctx, used);
+        return;
+    }
+    switch(subExpr.type) {
+        case TokenType::FuncCall:
+            if(!discarded && !types::isStdCall(subExpr, ctx)) {
+                used.insert(subExpr.children[0].value);
+            }
+            markUses(subExpr.children[2], false, ctx, used);
+            break;
+
+        case TokenType::ListDef:
+        case TokenType::TupDef:
+            for(const auto &item : literalItems(subExpr)) {
+                markUses(item, discarded, ctx, used);
+            }
+            break;
+
+        case TokenType::Ternary:
+            markUses(subExpr.children[1], false, ctx, used);
+            markUses(subExpr.children[3], discarded, ctx, used);
+            markUses(subExpr.children[5], discarded, ctx, used);
+            break;
+
+        case TokenType::Let:
+            markUses(subExpr.children[1], false, ctx, used);
+            markUses(subExpr.children[2], discarded, ctx, used);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*
+ * The functions of a module with main whose results are never used. Other
+ * modules' functions might be called from anywhere, so they have none
+ */
+std::set<std::string> findDiscardedFuncs(
+        const Token &program, const types::TypeContext &ctx) {
+    std::set<std::string> discarded;
+    bool hasMain = false;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            if(topLevelTok.children[0].value == "main") {
+                hasMain = true;
+            } else {
+                discarded.insert(topLevelTok.children[0].value);
+            }
+        }
+    }
+    if(!hasMain) {
+        return std::set<std::string>();
+    }
+
+    // A function's result can be used by main, or a function whose is
+    bool changed = true;
+    while(changed) {
+        std::set<std::string> used;
+        for(const auto &topLevelTok : program.children) {
+            if(topLevelTok.type == TokenType::FuncDef) {
+                markUses(
+                    topLevelTok.children[4],
+                    discarded.count(topLevelTok.children[0].value) > 0,
+                    ctx, used
+                );
+            }
+        }
+        changed = false;
+        for(const auto &name : used) {
+            changed = discarded.erase(name) > 0 || changed;
+        }
+    }
+    return discarded;
+}
+
+struct Sequencer {
+    const types::TypeContext &ctx;
+    std::string prefix;
+    size_t nextTemp;
+
+    Token tempName(const Token &at) {
+        return {
+            TokenType::Identifier, prefix + std::to_string(nextTemp++),
+            at.line, at.col, std::vector<Token>()
+        };
+    }
+
+    // Works out first, throwing its value away, then gives rest
+    Token then(const Token &first, const Token &rest) {
+        return seqExpr({
+            TokenType::Let, "", first.line, first.col,
+            std::vector<Token>({ tempName(first), first, rest })
+        });
+    }
+
+    // Stands in for a value nobody looks at
+    Token placeholder(const Token &at) {
+        return seqExpr({
+            TokenType::Decimal, "0", at.line, at.col, std::vector<Token>()
+        });
+    }
+
+    // Runs each item for what it does, in order. False if none do anything
+    bool sequence(const std::vector<Token> &items, Token &result) {
+        std::vector<Token> effects;
+        for(const auto &item : items) {
+            Token effect;
+            if(discard(item, effect)) {
+                effects.push_back(effect);
+            }
+        }
+        if(effects.empty()) {
+            return false;
+        }
+        result = effects.back();
+        for(size_t i = effects.size() - 1; i > 0; i--) {
+            result = then(effects[i - 1], result);
+        }
+        return true;
+    }
+
+    /*
+     * expr lowered for a place that throws its value away. False if it
+     * doesn't need working out at all
+     */
+    bool discard(const Token &expr, Token &result) {
+        const auto &subExpr = seqSubExpr(expr);
+        size_t kept;
+        if(projectsLiteral(expr, ctx, kept)) {
+            return sequence(
+                literalItems(seqSubExpr(subExpr.children[2])), result
+            );
+        }
+        switch(subExpr.type) {
+            case TokenType::ListDef:
+            case TokenType::TupDef:
+                return sequence(literalItems(subExpr), result);
+
+            case TokenType::Ternary: {
+                Token onTrue, onFalse;
+                const auto trueRuns = discard(subExpr.children[3], onTrue);
+                const auto falseRuns = discard(subExpr.children[5], onFalse);
+                const auto cond = use(subExpr.children[1]);
+                if(!trueRuns && !falseRuns) {
+                    result = cond;
+                    return !folding::isPure(cond, ctx);
+                }
+                auto ternary = subExpr;
+                ternary.children[1] = cond;
+                ternary.children[3] = trueRuns ? onTrue : placeholder(expr);
+                ternary.children[5] = falseRuns ? onFalse : placeholder(expr);
+                result = seqExpr(ternary);
+                return true;
+            }
+
+            case TokenType::Let: {
+                auto let = subExpr;
+                let.children[1] = use(subExpr.children[1]);
+                Token body;
+                if(!discard(subExpr.children[2], body)) {
+                    if(folding::isPure(let.children[1], ctx)) {
+                        return false;
+                    }
+                    body = placeholder(expr);
+                }
+                let.children[2] = body;
+                result = seqExpr(let);
+                return true;
+            }
+
+            default:
+                if(folding::isPure(expr, ctx)) {
+                    return false;
+                }
+                result = use(expr);
+                return true;
+        }
+    }
+
+    // expr with the parts whose values are thrown away lowered
+    Token use(const Token &expr) {
+        if(expr.type == TokenType::Identifier) {
+            return expr;
+        }
+        size_t kept;
+        if(projectsLiteral(expr, ctx, kept)) {
+            const auto items =
+                literalItems(seqSubExpr(expr.children[0].children[2]));
+            const auto value = use(items[kept]);
+            Token effect;
+            if(!discard(items[1 - kept], effect)) {
+                return value;
+            } else if(kept == 1) {
+                return then(effect, value);
+            }
+
+            // fst has to keep its value while the second item runs
+            const auto name = tempName(expr);
+            return seqExpr({
+                TokenType::Let, "", expr.line, expr.col,
+                std::vector<Token>({
+                    name, value, then(effect, seqExpr(name))
+                })
+            });
+        }
+        auto result = expr;
+        for(auto &child : result.children) {
+            if(child.type == TokenType::Expr
+                    || child.type == TokenType::FuncCall
+                    || child.type == TokenType::Ternary
+                    || child.type == TokenType::ListDef
+                    || child.type == TokenType::TupDef
+                    || child.type == TokenType::Let) {
+                child = use(child);
+            }
+        }
+        return result;
+    }
+};
+
+Token sequencing::lowerDiscarded(
+        const Token &program, const types::TypeContext &ctx) {
+    const auto discardedFuncs = findDiscardedFuncs(program, ctx);
+    Sequencer sequencer = { ctx, inlining::letPrefix(program, "s"), 0 };
+    auto result = program;
+    for(auto &topLevelTok : result.children) {
+        if(topLevelTok.type != TokenType::FuncDef) {
+            continue;
+        }
+        auto &body = topLevelTok.children[4];
+        Token lowered;
+        if(discardedFuncs.count(topLevelTok.children[0].value) == 0) {
+            body = sequencer.use(body);
+        } else if(sequencer.discard(body, lowered)) {
+            body = lowered;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,410 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of the compile server, its client & watch mode
+ */
+
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <Utility.hpp>
+#include <FileIo.hpp>
+#include <BuildGraph.hpp>
+#include <Driver.hpp>
+#include <Server.hpp>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/inotify.h>
+#endif
+
+using namespace nabd;
+
+std::string nabd::defaultSocketPath(void) {
+    const auto envPath = std::getenv("NABC_SERVER");
+    if(envPath != NULL && std::string(envPath) != "") {
+        return std::string(envPath);
+    }
+#if defined(__linux__)
+    const auto runtimeDir = std::getenv("XDG_RUNTIME_DIR");
+    if(runtimeDir != NULL && std::string(runtimeDir) != "") {
+        return std::string(runtimeDir) + "/nabc.sock";
+    }
+    return "/tmp/nabc-" + std::to_string(getuid()) + ".sock";
+#else
+    return "";
+#endif
+}
+
+#if defined(__linux__)
+
+bool writeAll(const int fd, const std::string &data) {
+    size_t written = 0;
+    while(written < data.length()) {
+        const auto res = write(
+            fd, data.c_str() + written, data.length() - written
+        );
+        if(res <= 0) {
+            return false;
+        }
+        written += static_cast<size_t>(res);
+    }
+    return true;
+}
+
+sockaddr_un socketAddress(const std::string &socketPath) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if(socketPath.length() >= sizeof(addr.sun_path)) {
+        errorOut("Socket path '" + socketPath + "' is too long!");
+    }
+    std::strcpy(addr.sun_path, socketPath.c_str());
+    return addr;
+}
+
+/*
+ * A request is the client's working directory followed by its arguments,
+ * each terminated by a NUL, with an empty string at the end.
+ * The reply is everything the build printed, a NUL and then the exit code
+ */
+void handleRequest(const int client, const std::string &nabcPath) {
+    std::vector<std::string> parts;
+    std::string part;
+    char c;
+    while(read(client, &c, 1) == 1) {
+        if(c != '\0') {
+            part += c;
+            continue;
+        }
+        if(part == "") {
+            break;
+        }
+        parts.push_back(part);
+        part = "";
+    }
+    if(parts.size() < 2) {
+        return;
+    }
+
+    const auto serverDir = getCurrentDir();
+    std::vector<const char *> args({ nabcPath.c_str() });
+    for(size_t i = 1; i < parts.size(); i++) {
+        args.push_back(parts[i].c_str());
+    }
+
+    // Everything the build prints (including make & g++) goes to the client
+    std::cout.flush();
+    std::fflush(stdout);
+    std::fflush(stderr);
+    const auto savedOut = dup(1), savedErr = dup(2);
+    dup2(client, 1);
+    dup2(client, 2);
+
+    int exitCode = 0;
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        if(chdir(parts[0].c_str()) != 0) {
+            errorOut("Server can't access folder '" + parts[0] + "'!");
+        }
+        const auto inputs = parseArguments(
+            static_cast<int>(args.size()), args.data()
+        );
+        runCompiler(inputs, nabcPath);
+    } catch(const CompileError &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        exitCode = 255;
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    std::cout.flush();
+    std::fflush(stdout);
+    std::fflush(stderr);
+    dup2(savedOut, 1);
+    dup2(savedErr, 2);
+    close(savedOut);
+    close(savedErr);
+    if(chdir(serverDir.c_str()) != 0) {
+        std::cerr << "Failed to return to '" << serverDir << "'" << std::endl;
+    }
+
+    std::cout
+        << "Handled '" << parts[1] << "' from '" << parts[0] << "' in "
+        << elapsed << "ms (exit code " << exitCode << ")" << std::endl;
+    writeAll(client, std::string(1, '\0') + std::to_string(exitCode));
+}
+
+void nabd::runServer(
+        const std::string &socketPath, const std::string &nabcPath) {
+    // Clients going away mid reply shouldn't take the server down with them
+    signal(SIGPIPE, SIG_IGN);
+
+    const auto server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(server < 0) {
+        errorOut("Failed to create the server socket!");
+    }
+    const auto addr = socketAddress(socketPath);
+    unlink(socketPath.c_str());
+    if(bind(
+                server, reinterpret_cast<const sockaddr *>(&addr),
+                sizeof(addr)) != 0
+            || listen(server, 16) != 0) {
+        close(server);
+        errorOut("Failed to listen on '" + socketPath + "'!");
+    }
+
+    // Modules in requests are relative to the client, but nabc isn't
+    const auto fullNabcPath = getFullPath(nabcPath);
+    std::cout << "nabc server listening on '" << socketPath << "'" << std::endl;
+    while(true) {
+        const auto client = accept(server, NULL, NULL);
+        if(client < 0) {
+            continue;
+        }
+        handleRequest(client, fullNabcPath);
+        close(client);
+    }
+}
+
+bool nabd::runClient(
+        const std::string &socketPath, const int argc, const char **args,
+        int &exitCode) {
+    const auto server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(server < 0) {
+        return false;
+    }
+    const auto addr = socketAddress(socketPath);
+    if(connect(
+            server, reinterpret_cast<const sockaddr *>(&addr),
+            sizeof(addr)) != 0) {
+        close(server);
+        return false;
+    }
+
+    std::string request = getCurrentDir() + std::string(1, '\0');
+    for(int i = 1; i < argc; i++) {
+        if(std::string(args[i]) == "--socket" && i + 1 < argc) {
+            i++;
+            continue;
+        }
+        request += std::string(args[i]) + std::string(1, '\0');
+    }
+    request += std::string(1, '\0');
+    if(!writeAll(server, request)) {
+        close(server);
+        return false;
+    }
+
+    // Echo the build output until the NUL that separates the exit code
+    std::string exitCodeStr;
+    bool inExitCode = false;
+    char buff[4096];
+    ssize_t len;
+    while((len = read(server, buff, sizeof(buff))) > 0) {
+        for(ssize_t i = 0; i < len; i++) {
+            if(inExitCode) {
+                exitCodeStr += buff[i];
+            } else if(buff[i] == '\0') {
+                inExitCode = true;
+            } else {
+                std::cout << buff[i];
+            }
+        }
+    }
+    std::cout.flush();
+    close(server);
+
+    if(!inExitCode) {
+        errorOut("Lost connection to the compile server!");
+    }
+    exitCode = std::atoi(exitCodeStr.c_str());
+    return true;
+}
+
+std::string parentFolder(const std::string &fileName) {
+    const auto sep = fileName.find_last_of("/\\");
+    return sep != std::string::npos ? fileName.substr(0, sep) : ".";
+}
+
+std::string objectFileFor(const ModuleInfo &modInfo) {
+    // buildObj copies the object next to the module
+    return (modInfo.relativeDirectory != "" ?
+        (modInfo.relativeDirectory + "/") : "") + modInfo.moduleName + ".o";
+}
+
+// Rebuild the given modules and relink. False if anything failed
+bool rebuild(
+        const std::vector<ModuleNode> &modules,
+        const std::vector<ModuleNode> &toBuild,
+        const InputArguments &inputs, const std::string &nabcPath) {
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        for(const auto &module : toBuild) {
+            auto moduleInputs = inputs;
+            moduleInputs.fileName = module.modInfo.fileName;
+            moduleInputs.objects.clear();
+            moduleInputs.watch = false;
+            runCompiler(moduleInputs, nabcPath);
+        }
+
+        auto linkInputs = inputs;
+        linkInputs.fileName =
+            inputs.outputName != "" ?
+                inputs.outputName :
+                moduleInfoFor(inputs).moduleName;
+        linkInputs.link = true;
+        linkInputs.watch = false;
+        linkInputs.objects.clear();
+        for(const auto &module : modules) {
+            linkInputs.objects.push_back(objectFileFor(module.modInfo));
+        }
+        for(const auto &obj : inputs.objects) {
+            linkInputs.objects.push_back(obj);
+        }
+        runCompiler(linkInputs, nabcPath);
+    } catch(const CompileError &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return false;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    std::cout
+        << "Rebuilt " << toBuild.size() << " module(s) and relinked in "
+        << elapsed << "ms. Watching for changes..." << std::endl;
+    return true;
+}
+
+// Blocks until something changes, then gives the full paths of what did
+std::set<std::string> waitForChanges(
+        const int notifyFd, const std::map<int, std::string> &watches) {
+    std::set<std::string> changed;
+    alignas(inotify_event) char buff[4096];
+
+    // Editors tend to touch files several times in a row, so wait a moment
+    pollfd pfd = { notifyFd, POLLIN, 0 };
+    int timeout = -1;
+    while(poll(&pfd, 1, timeout) > 0) {
+        const auto len = read(notifyFd, buff, sizeof(buff));
+        if(len <= 0) {
+            break;
+        }
+        for(ssize_t i = 0; i < len; ) {
+            const auto event =
+                reinterpret_cast<const inotify_event *>(buff + i);
+            const auto folder = watches.find(event->wd);
+            if(event->len > 0 && folder != watches.end()) {
+                changed.insert(
+                    getFullPath(folder->second + "/" + std::string(event->name))
+                );
+            }
+            i += sizeof(inotify_event) + event->len;
+        }
+        timeout = 50;
+    }
+    return changed;
+}
+
+void nabd::runWatch(const InputArguments &inputs, const std::string &nabcPath) {
+    auto modules = collectModules(inputs);
+    rebuild(modules, modules, inputs, nabcPath);
+
+    const auto notifyFd = inotify_init1(IN_CLOEXEC);
+    if(notifyFd < 0) {
+        errorOut("Failed to start watching for file changes!");
+    }
+
+    std::map<int, std::string> watches;
+    std::set<std::string> failed;
+    while(true) {
+        // Includes can change, so make sure every folder involved is watched
+        for(const auto &module : modules) {
+            for(const auto &dep : module.dependencies) {
+                const auto folder = parentFolder(dep);
+                const auto wd = inotify_add_watch(
+                    notifyFd, folder.c_str(),
+                    IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE
+                );
+                if(wd >= 0) {
+                    watches[wd] = folder;
+                }
+            }
+        }
+
+        const auto changed = waitForChanges(notifyFd, watches);
+        bool sourceChanged = false;
+        for(const auto &fileName : changed) {
+            const auto ext = fileName.substr(fileName.find_last_of('.') + 1);
+            sourceChanged = sourceChanged || ext == "nabd" || ext == "hpp";
+        }
+        if(!sourceChanged) {
+            // Probably just our own build output
+            continue;
+        }
+
+        // A module needs rebuilding if it or anything it includes changed
+        std::vector<ModuleNode> newModules;
+        try {
+            newModules = collectModules(inputs);
+        } catch(const CompileError &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            continue;
+        }
+        std::set<std::string> known;
+        for(const auto &module : modules) {
+            known.insert(getFullPath(module.modInfo.fileName));
+        }
+        std::vector<ModuleNode> toBuild;
+        for(const auto &module : newModules) {
+            const auto fullPath = getFullPath(module.modInfo.fileName);
+            bool affected =
+                known.count(fullPath) == 0 || failed.count(fullPath) > 0;
+            for(const auto &dep : module.dependencies) {
+                affected = affected || changed.count(getFullPath(dep)) > 0;
+            }
+            if(affected) {
+                toBuild.push_back(module);
+            }
+        }
+        modules = newModules;
+        if(toBuild.empty()) {
+            continue;
+        }
+
+        failed.clear();
+        if(!rebuild(modules, toBuild, inputs, nabcPath)) {
+            for(const auto &module : toBuild) {
+                failed.insert(getFullPath(module.modInfo.fileName));
+            }
+        }
+    }
+}
+
+#else
+
+void nabd::runServer(
+        const std::string &socketPath, const std::string &nabcPath) {
+    errorOut("The compile server is only supported on Linux!");
+}
+
+bool nabd::runClient(
+        const std::string &socketPath, const int argc, const char **args,
+        int &exitCode) {
+    return false;
+}
+
+void nabd::runWatch(const InputArguments &inputs, const std::string &nabcPath) {
+    errorOut("Watch mode is only supported on Linux!");
+}
+
+#endif
@@ -0,0 +1,302 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of finding groups of tail calling functions
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstdint>
+#include <Token.hpp>
+#include <TypeInfer.hpp>
+#include <TailCalls.hpp>
+
+using namespace nabd;
+using namespace nabd::tailcalls;
+
+std::string tailcalls::calleeName(
+        const Token &funcCall, const types::TypeContext &types) {
+    if(types::isStdCall(funcCall, types)) {
+        return "";
+    }
+    const auto &callee = funcCall.children[0].value;
+    return types::callsNumberClone(funcCall, types) ?
+        types::numberCloneName(callee) : callee;
+}
+
+std::string tailcalls::groupFuncName(const std::string &funcName) {
+    return funcName + "__tail";
+}
+
+const Token *tailcalls::stepsAround(
+        const Token &funcCall, const types::TypeContext &types,
+        std::vector<std::string> &steps) {
+    const Token *call = &funcCall;
+    while(types::isStdCall(*call, types)
+            && (call->children[0].value == "inc"
+                || call->children[0].value == "dec")) {
+        steps.push_back(call->children[0].value);
+        const auto &arg = call->children[2];
+        if(arg.type == TokenType::Identifier
+                || arg.children[0].type != TokenType::FuncCall) {
+            return nullptr;
+        }
+        call = &arg.children[0];
+    }
+    return call;
+}
+
+// A call made as the last thing a function does
+struct TailCall {
+    std::string callee;
+    std::vector<std::string> steps;
+    bool inCons;
+    const Token *call;
+};
+
+/*
+ * The functions expr calls last, through any ternaries. A list's last
+ * item or a tuple's second one counts too, as the list or tuple can be
+ * made first and have the result put in it afterwards
+ */
+void findTailCalls(
+        const Token &expr, const types::TypeContext &types,
+        const bool inCons, std::vector<TailCall> &calls) {
+    const auto &subExpr =
+        expr.type == TokenType::Identifier ?
+            expr :
+            expr.children[0];
+    if(subExpr.type == TokenType::Ternary) {
+        findTailCalls(subExpr.children[3], types, inCons, calls);
+        findTailCalls(subExpr.children[5], types, inCons, calls);
+    } else if(subExpr.type == TokenType::Let) {
+        findTailCalls(subExpr.children[2], types, inCons, calls);
+    } else if(subExpr.type == TokenType::ListDef
+            || subExpr.type == TokenType::TupDef) {
+        findTailCalls(
+            subExpr.children[subExpr.children.size() - 2], types, true, calls
+        );
+    } else if(subExpr.type == TokenType::FuncCall) {
+        // Steps can't be left for later once the result goes in a list
+        std::vector<std::string> steps;
+        const auto call =
+            inCons ? &subExpr : stepsAround(subExpr, types, steps);
+        const auto callee =
+            call == nullptr ? "" : calleeName(*call, types);
+        if(callee != "") {
+            calls.push_back({ callee, steps, inCons, call });
+        }
+    }
+}
+
+std::set<const Token *> tailcalls::tailCallsIn(
+        const Token &expr, const types::TypeContext &types) {
+    std::vector<TailCall> calls;
+    findTailCalls(expr, types, false, calls);
+    std::set<const Token *> tokens;
+    for(const auto &call : calls) {
+        tokens.insert(call.call);
+    }
+    return tokens;
+}
+
+// Tarjan's strongly connected components
+struct GroupFinder {
+    const std::vector<std::vector<size_t>> &edges;
+    std::vector<size_t> index, lowLink;
+    std::vector<bool> onStack;
+    std::vector<size_t> stack;
+    size_t nextIndex;
+    std::vector<std::vector<size_t>> components;
+
+    void visit(const size_t member) {
+        index[member] = lowLink[member] = nextIndex++;
+        stack.push_back(member);
+        onStack[member] = true;
+        for(const auto callee : edges[member]) {
+            if(index[callee] == SIZE_MAX) {
+                visit(callee);
+                lowLink[member] = std::min(lowLink[member], lowLink[callee]);
+            } else if(onStack[callee]) {
+                lowLink[member] = std::min(lowLink[member], index[callee]);
+            }
+        }
+        if(lowLink[member] != index[member]) {
+            return;
+        }
+        std::vector<size_t> component;
+        size_t popped;
+        do {
+            popped = stack.back();
+            stack.pop_back();
+            onStack[popped] = false;
+            component.push_back(popped);
+        } while(popped != member);
+        std::sort(component.begin(), component.end());
+        components.push_back(component);
+    }
+};
+
+std::vector<std::vector<size_t>> tailcalls::stronglyConnected(
+        const std::vector<std::vector<size_t>> &edges) {
+    GroupFinder finder = {
+        edges,
+        std::vector<size_t>(edges.size(), SIZE_MAX),
+        std::vector<size_t>(edges.size(), SIZE_MAX),
+        std::vector<bool>(edges.size(), false),
+        std::vector<size_t>(), 0, std::vector<std::vector<size_t>>()
+    };
+    for(size_t i = 0; i < edges.size(); i++) {
+        if(finder.index[i] == SIZE_MAX) {
+            finder.visit(i);
+        }
+    }
+    return finder.components;
+}
+
+/*
+ * Adds the loops among members to tailGroups. Calls with steps around
+ * them only count from members that mayStep, and a group can only have
+ * one set of steps, and none if it also builds lists or tuples
+ */
+void addGroups(
+        const std::vector<TailMember> &members,
+        const std::map<std::string, size_t> &memberInds,
+        const std::vector<std::vector<TailCall>> &calls,
+        const std::vector<bool> &mayStep, const types::TypeContext &types,
+        TailGroups &tailGroups) {
+    std::vector<std::vector<size_t>> edges(members.size());
+    std::vector<bool> callsSelf(members.size(), false);
+    for(size_t i = 0; i < members.size(); i++) {
+        for(const auto &call : calls[i]) {
+            if(call.steps.size() > 0 && !mayStep[i]) {
+                continue;
+            }
+            const auto callee = memberInds.at(call.callee);
+            edges[i].push_back(callee);
+            callsSelf[i] = callsSelf[i] || callee == i;
+        }
+    }
+
+    // Components are found callees first, so sort them back into order
+    auto components = stronglyConnected(edges);
+    std::sort(components.begin(), components.end());
+    for(const auto &component : components) {
+        const auto loops = component.size() > 1 || callsSelf[component[0]];
+        const auto name = groupFuncName(members[component[0]].name);
+        if(!loops || types.userFuncs->count(name) > 0) {
+            continue;
+        }
+
+        std::set<std::vector<std::string>> stepSets;
+        bool cons = false;
+        for(const auto member : component) {
+            for(const auto &call : calls[member]) {
+                const auto callee = memberInds.at(call.callee);
+                if(!std::binary_search(
+                        component.begin(), component.end(), callee)
+                        || (call.steps.size() > 0 && !mayStep[member])) {
+                    continue;
+                }
+                cons = cons || call.inCons;
+                if(call.steps.size() > 0) {
+                    stepSets.insert(call.steps);
+                }
+            }
+        }
+        if(stepSets.size() > 1 || (stepSets.size() == 1 && cons)) {
+            continue;
+        }
+
+        TailGroup group = {
+            name, std::vector<TailMember>(),
+            stepSets.size() == 1 ?
+                *stepSets.begin() : std::vector<std::string>()
+        };
+        for(const auto member : component) {
+            tailGroups.byName[members[member].name] = {
+                tailGroups.groups.size(), group.members.size()
+            };
+            group.members.push_back(members[member]);
+        }
+        tailGroups.groups.push_back(group);
+    }
+}
+
+TailGroups tailcalls::findTailGroups(
+        const Token &program, const types::TypeContext &types) {
+    // Every function the module generates, but main and memoized ones
+    std::vector<TailMember> members;
+    std::map<std::string, size_t> memberInds;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type != TokenType::FuncDef
+                || topLevelTok.children[0].value == "main"
+                || types.memoized->count(topLevelTok.children[0].value) > 0) {
+            continue;
+        }
+        const auto &name = topLevelTok.children[0].value;
+        memberInds[name] = members.size();
+        members.push_back({ &topLevelTok, false, name });
+        if(types.numberClones->count(name) > 0) {
+            const auto cloneName = types::numberCloneName(name);
+            memberInds[cloneName] = members.size();
+            members.push_back({ &topLevelTok, true, cloneName });
+        }
+    }
+
+    std::vector<std::vector<TailCall>> calls(members.size());
+    for(size_t i = 0; i < members.size(); i++) {
+        auto memberTypes = types;
+        if(members[i].isClone) {
+            memberTypes.numberParam = members[i].funcDef->children[2].value;
+        }
+        std::vector<TailCall> memberCalls;
+        findTailCalls(
+            members[i].funcDef->children[4], memberTypes, false, memberCalls
+        );
+        for(const auto &call : memberCalls) {
+            if(memberInds.count(call.callee) > 0) {
+                calls[i].push_back(call);
+            }
+        }
+    }
+
+    TailGroups tailGroups;
+    std::vector<bool> mayStep(members.size(), true);
+    addGroups(members, memberInds, calls, mayStep, types, tailGroups);
+
+    /*
+     * Members of groups that couldn't agree on their steps (or that also
+     * build lists) still loop over the calls without any
+     */
+    std::vector<bool> inGroup(members.size(), false);
+    for(const auto &group : tailGroups.groups) {
+        for(const auto &member : group.members) {
+            inGroup[memberInds.at(member.name)] = true;
+        }
+    }
+    bool anyRetries = false;
+    for(size_t i = 0; i < members.size(); i++) {
+        for(const auto &call : calls[i]) {
+            anyRetries = anyRetries || (!inGroup[i] && call.steps.size() > 0);
+        }
+    }
+    if(anyRetries) {
+        TailGroups stepless;
+        addGroups(members, memberInds, calls, inGroup, types, stepless);
+        for(const auto &group : stepless.groups) {
+            if(inGroup[memberInds.at(group.members[0].name)]) {
+                continue;
+            }
+            for(size_t j = 0; j < group.members.size(); j++) {
+                tailGroups.byName[group.members[j].name] = {
+                    tailGroups.groups.size(), j
+                };
+            }
+            tailGroups.groups.push_back(group);
+        }
+    }
+    return tailGroups;
+}
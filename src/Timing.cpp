@@ -0,0 +1,52 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of build phase timing
+ */
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <chrono>
+#include <Utility.hpp>
+#include <Timing.hpp>
+
+using namespace nabd;
+
+PhaseTimings &nabd::phaseTimings(void) {
+    thread_local PhaseTimings timings;
+    return timings;
+}
+
+PhaseTimer::PhaseTimer(double &phaseMs) :
+        total(phaseMs), start(std::chrono::steady_clock::now()) {
+}
+
+PhaseTimer::~PhaseTimer(void) {
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    total += elapsed.count();
+}
+
+void nabd::appendTimings(
+        const std::string &fileName,
+        const std::string &moduleName, const std::string &mode,
+        const PhaseTimings &timings, const double totalMs) {
+    std::stringstream line;
+    line.setf(std::ios::fixed);
+    line.precision(3);
+    line
+        << "{\"module\": \"" << moduleName << "\", \"mode\": \"" << mode
+        << "\", \"parse_ms\": " << timings.parseMs
+        << ", \"codegen_ms\": " << timings.codeGenMs
+        << ", \"cxx_ms\": " << timings.cxxMs
+        << ", \"link_ms\": " << timings.linkMs
+        << ", \"total_ms\": " << totalMs << "}\n";
+
+    // Parallel builds append to the same file, so write the line in one go
+    std::ofstream file(fileName, std::ios::app);
+    if(!file.is_open()) {
+        errorOut("Could not open timings file '" + fileName + "'!");
+    }
+    file << line.str();
+    file.flush();
+}
@@ -20,6 +20,7 @@ const std::map<nabd::TokenType, std::string> g_typeStr = {
     { TokenType::Ternary,       "Ternary" },
     { TokenType::ListDef,       "ListDef" },
     { TokenType::TupDef,        "TupDef" },
+    { TokenType::Let,           "Let" },
     { TokenType::Expr,          "Expr" },
     { TokenType::DolSign,       "DolSign" },
     { TokenType::EquSign,       "EquSign" },
@@ -0,0 +1,254 @@
+/*
+ * Author: Dylan Turner
+ * Description: Implementation of compile time type inference
+ */
+
+#include <string>
+#include <set>
+#include <map>
+#include <vector>
+#include <memory>
+#include <Utility.hpp>
+#include <Token.hpp>
+#include <FileIo.hpp>
+#include <ModuleCache.hpp>
+#include <TypeInfer.hpp>
+
+using namespace nabd;
+using namespace nabd::types;
+
+// What each std function always returns (see lib/src/std.cpp)
+const std::map<std::string, ExprType> g_stdResultTypes = {
+    { "print", ExprType::String }, { "input", ExprType::String },
+    { "parseNum", ExprType::Number }, { "len", ExprType::Number },
+    { "gt", ExprType::Number }, { "lt", ExprType::Number },
+    { "eq", ExprType::Number }, { "gte", ExprType::Number },
+    { "lte", ExprType::Number }, { "ne", ExprType::Number },
+    { "seedRandom", ExprType::Number }, { "random", ExprType::Number },
+    { "round", ExprType::Number }, { "floor", ExprType::Number },
+    { "ceil", ExprType::Number }, { "inc", ExprType::Number },
+    { "dec", ExprType::Number }, { "dup", ExprType::Tuple }
+};
+
+// Collects the functions in ownFuncs that a call in tok passes a number
+void findNumberCalls(
+        const Token &tok, const TypeContext &ctx,
+        const std::map<std::string, const Token *> &ownFuncs,
+        std::set<std::string> &found) {
+    if(tok.type == TokenType::FuncCall
+            && ownFuncs.count(tok.children[0].value) > 0
+            && inferType(tok.children[2], ctx) == ExprType::Number) {
+        found.insert(tok.children[0].value);
+    }
+    for(const auto &child : tok.children) {
+        findNumberCalls(child, ctx, ownFuncs, found);
+    }
+}
+
+// Whether every use of param in tok is as the argument of std's fst or snd
+bool onlyTakenApart(
+        const Token &tok, const std::string &param, const TypeContext &ctx) {
+    if(tok.type == TokenType::Identifier) {
+        return tok.value != param;
+    }
+    if(tok.type == TokenType::FuncCall && isStdCall(tok, ctx)
+            && (tok.children[0].value == "fst"
+                || tok.children[0].value == "snd")) {
+        const auto &arg = tok.children[2];
+        if(arg.type == TokenType::Identifier
+                || arg.children[0].type == TokenType::Identifier) {
+            return true;
+        }
+    }
+
+    // A call's callee and a Let's name aren't uses of a parameter
+    const size_t first =
+        tok.type == TokenType::FuncCall || tok.type == TokenType::Let ? 1 : 0;
+    for(size_t i = first; i < tok.children.size(); i++) {
+        if(!onlyTakenApart(tok.children[i], param, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Collects the functions in unpackable that a call in tok passes a tuple
+void findTupleCalls(
+        const Token &tok, const std::set<std::string> &unpackable,
+        std::set<std::string> &found) {
+    if(tok.type == TokenType::FuncCall
+            && unpackable.count(tok.children[0].value) > 0) {
+        const auto &arg = tok.children[2];
+        if(arg.type == TokenType::Expr
+                && arg.children[0].type == TokenType::TupDef) {
+            found.insert(tok.children[0].value);
+        }
+    }
+    for(const auto &child : tok.children) {
+        findTupleCalls(child, unpackable, found);
+    }
+}
+
+TypeContext types::moduleTypeContext(
+        const Token &program, const InputArguments &cliInputs) {
+    TypeContext ctx;
+    std::set<std::string> userFuncs;
+    std::vector<const Token *> funcDefs;
+    for(const auto &topLevelTok : program.children) {
+        if(topLevelTok.type == TokenType::FuncDef) {
+            userFuncs.insert(topLevelTok.children[0].value);
+            funcDefs.push_back(&topLevelTok);
+        } else if(topLevelTok.type == TokenType::Include) {
+            // Missing modules get reported (with a location) by codegen
+            ModuleLocation location;
+            try {
+                location = findModule(topLevelTok.children[1].value, cliInputs);
+            } catch(const CompileError &) {
+                continue;
+            }
+            if(location.isCpp) {
+                ctx.hasStd = ctx.hasStd
+                    || topLevelTok.children[1].value == "std";
+                continue;
+            }
+            const auto included = loadModule(location.fileName);
+            for(const auto &tok : included->children) {
+                if(tok.type == TokenType::FuncDef) {
+                    userFuncs.insert(tok.children[0].value);
+                }
+            }
+        }
+    }
+    ctx.userFuncs = std::make_shared<const std::set<std::string>>(userFuncs);
+
+    /*
+     * Only the module's own functions get clones, as other modules can't
+     * know which of theirs exist. main is only ever called by the runtime
+     */
+    std::map<std::string, const Token *> ownFuncs;
+    for(const auto funcDef : funcDefs) {
+        const auto &name = funcDef->children[0].value;
+        if(name != "main" && userFuncs.count(numberCloneName(name)) == 0) {
+            ownFuncs[name] = funcDef;
+        }
+    }
+
+    // A clone's body can pass its (now known) parameter on to another one
+    std::set<std::string> clones;
+    std::vector<std::pair<const Token *, std::string>> toScan;
+    for(const auto funcDef : funcDefs) {
+        toScan.push_back({ funcDef, "" });
+    }
+    while(!toScan.empty()) {
+        const auto scan = toScan.back();
+        toScan.pop_back();
+        ctx.numberParam = scan.second;
+        std::set<std::string> found;
+        findNumberCalls(scan.first->children[4], ctx, ownFuncs, found);
+        for(const auto &name : found) {
+            if(clones.insert(name).second) {
+                const auto funcDef = ownFuncs.at(name);
+                toScan.push_back({ funcDef, funcDef->children[2].value });
+            }
+        }
+    }
+    ctx.numberParam = "";
+    ctx.numberClones = std::make_shared<const std::set<std::string>>(clones);
+
+    // A call never has the choice of a number clone and a tuple clone
+    std::set<std::string> unpackable;
+    for(const auto &func : ownFuncs) {
+        const auto &param = func.second->children[2].value;
+        if(clones.count(func.first) == 0
+                && userFuncs.count(tupleCloneName(func.first)) == 0
+                && userFuncs.count(tupleHalfName(param, "fst")) == 0
+                && userFuncs.count(tupleHalfName(param, "snd")) == 0
+                && onlyTakenApart(func.second->children[4], param, ctx)) {
+            unpackable.insert(func.first);
+        }
+    }
+    std::set<std::string> tupleClones;
+    for(const auto funcDef : funcDefs) {
+        findTupleCalls(funcDef->children[4], unpackable, tupleClones);
+    }
+    ctx.tupleClones =
+        std::make_shared<const std::set<std::string>>(tupleClones);
+    return ctx;
+}
+
+std::string types::numberCloneName(const std::string &funcName) {
+    return funcName + "__num";
+}
+
+bool types::callsNumberClone(const Token &funcCall, const TypeContext &ctx) {
+    return ctx.numberClones->count(funcCall.children[0].value) > 0
+        && inferType(funcCall.children[2], ctx) == ExprType::Number;
+}
+
+std::string types::tupleCloneName(const std::string &funcName) {
+    return funcName + "__tup";
+}
+
+std::string types::tupleHalfName(
+        const std::string &param, const std::string &half) {
+    return param + "__" + half;
+}
+
+bool types::callsTupleClone(const Token &funcCall, const TypeContext &ctx) {
+    const auto &arg = funcCall.children[2];
+    return ctx.tupleClones->count(funcCall.children[0].value) > 0
+        && arg.type == TokenType::Expr
+        && arg.children[0].type == TokenType::TupDef;
+}
+
+bool types::isStdCall(const Token &funcCall, const TypeContext &ctx) {
+    return ctx.hasStd
+        && ctx.userFuncs->count(funcCall.children[0].value) == 0;
+}
+
+ExprType types::inferType(const Token &expr, const TypeContext &ctx) {
+    const auto &subExpr =
+        expr.type == TokenType::Identifier ?
+            expr :
+            expr.children[0];
+    switch(subExpr.type) {
+        case TokenType::Decimal:
+        case TokenType::Hex:
+            return ExprType::Number;
+
+        case TokenType::String:
+            return ExprType::String;
+
+        case TokenType::Identifier:
+            return subExpr.value == ctx.numberParam ?
+                ExprType::Number : ExprType::Unknown;
+
+        case TokenType::TupDef:
+            return ExprType::Tuple;
+
+        case TokenType::ListDef:
+            return ExprType::List;
+
+        case TokenType::Ternary: {
+            const auto whenTrue = inferType(subExpr.children[3], ctx);
+            return whenTrue == inferType(subExpr.children[5], ctx) ?
+                whenTrue : ExprType::Unknown;
+        }
+
+        case TokenType::Let:
+            return inferType(subExpr.children[2], ctx);
+
+        case TokenType::FuncCall: {
+            const auto &callee = subExpr.children[0].value;
+            const auto result = g_stdResultTypes.find(callee);
+            if(result != g_stdResultTypes.end()
+                    && isStdCall(subExpr, ctx)) {
+                return result->second;
+            }
+            return ExprType::Unknown;
+        }
+
+        default:
+            return ExprType::Unknown;
+    }
+}
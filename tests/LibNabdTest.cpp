@@ -0,0 +1,692 @@
+/*
+ * Author: Dylan Turner
+ * Description:
+ *  - Tests of the compiler used as a library (libnabd)
+ *  - Compiles several snippets at once from different threads and makes sure
+ *    a broken one is reported instead of ending the process
+ *  - Also generates a snippet with the plain C backend, checks that std
+ *    calls on constants (and pure user functions) are folded away, that
+ *    tail calls (even inside inc/dec) become loops, that --stack runs main
+ *    on a thread, that small functions (even other modules') are inlined,
+ *    that functions main never reaches are left out, that repeated pure
+ *    calls are worked out once, that --memoize caches pure recursion,
+ *    that lists made only to run things in order are never built, that
+ *    tuple literals are passed as their halves and that literals are made
+ *    once as constants
+ *  - Builds and runs snippets to check a list holding the same value twice
+ *    (one constant, or the result of a call worked out once) still prints
+ *    all of it, that the C backend prints lists like the C++ one and that
+ *    a module split into shards makes its constants in only one of them
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+#include <Nabd.hpp>
+
+void testCompileSource(void);
+void testParseError(void);
+void testConcurrentCompiles(void);
+void testCBackend(void);
+void testConstantFolding(void);
+void testPureCalls(void);
+void testTailCalls(void);
+void testBigStack(void);
+void testAccumulators(void);
+void testInlining(void);
+void testImportInlining(void);
+void testDeadCode(void);
+void testCse(void);
+void testMemoize(void);
+void testSequencing(void);
+void testTupleClones(void);
+void testConstants(void);
+void testRepeatedItems(void);
+void testShardedConstants(void);
+
+int main(const int argc, const char **args) {
+    for(int i = 1; i < argc; i++) {
+        if(std::string(args[i]) == "all") {
+            testCompileSource();
+            testParseError();
+            testConcurrentCompiles();
+            testCBackend();
+            testConstantFolding();
+            testPureCalls();
+            testTailCalls();
+            testBigStack();
+            testAccumulators();
+            testInlining();
+            testImportInlining();
+            testDeadCode();
+            testCse();
+            testMemoize();
+            testSequencing();
+            testTupleClones();
+            testConstants();
+            testRepeatedItems();
+            testShardedConstants();
+        } else if(std::string(args[i]) == "compileSource") {
+            testCompileSource();
+        } else if(std::string(args[i]) == "parseError") {
+            testParseError();
+        } else if(std::string(args[i]) == "concurrent") {
+            testConcurrentCompiles();
+        } else if(std::string(args[i]) == "cBackend") {
+            testCBackend();
+        } else if(std::string(args[i]) == "constFold") {
+            testConstantFolding();
+        } else if(std::string(args[i]) == "pureCalls") {
+            testPureCalls();
+        } else if(std::string(args[i]) == "tailCalls") {
+            testTailCalls();
+        } else if(std::string(args[i]) == "bigStack") {
+            testBigStack();
+        } else if(std::string(args[i]) == "accumulators") {
+            testAccumulators();
+        } else if(std::string(args[i]) == "inlining") {
+            testInlining();
+        } else if(std::string(args[i]) == "importInlining") {
+            testImportInlining();
+        } else if(std::string(args[i]) == "deadCode") {
+            testDeadCode();
+        } else if(std::string(args[i]) == "cse") {
+            testCse();
+        } else if(std::string(args[i]) == "memoize") {
+            testMemoize();
+        } else if(std::string(args[i]) == "sequencing") {
+            testSequencing();
+        } else if(std::string(args[i]) == "tupleClones") {
+            testTupleClones();
+        } else if(std::string(args[i]) == "constants") {
+            testConstants();
+        } else if(std::string(args[i]) == "repeatedItems") {
+            testRepeatedItems();
+        } else if(std::string(args[i]) == "shardedConstants") {
+            testShardedConstants();
+        }
+    }
+}
+
+nabd::InputArguments snippetInputs(const int index) {
+    nabd::InputArguments inputs;
+    inputs.fileName = "obj/snippet" + std::to_string(index) + ".nabd";
+    inputs.includeFolders.push_back("lib/include");
+    return inputs;
+}
+
+// The name of the constant made as made, or "" if there isn't one
+std::string constantFor(const std::string &code, const std::string &made) {
+    const auto at = code.find(" = " + made + ";\n");
+    if(at == std::string::npos) {
+        return "";
+    }
+    const auto start = code.rfind(' ', at - 1) + 1;
+    return code.substr(start, at - start);
+}
+
+/*
+ * Builds the snippet into a program and gives what it prints with input as
+ * its stdin, or "" if it doesn't build. Much slower than looking at the
+ * generated code, so only for checking what the runtime does with it
+ */
+std::string runSnippet(
+        const std::string &snippet, nabd::InputArguments inputs,
+        const std::string &input) {
+    const auto name =
+        inputs.fileName.substr(0, inputs.fileName.find(".nabd"));
+    std::ofstream(inputs.fileName) << snippet;
+    std::ofstream(name + ".in") << input;
+    if(!nabd::compileModule(inputs).success()) {
+        return "";
+    }
+
+    inputs.fileName = name + "_run";
+    inputs.link = true;
+    inputs.objects.push_back(name + ".o");
+    if(!nabd::linkProgram(inputs).success()) {
+        return "";
+    }
+    std::system((
+        name + "_run < " + name + ".in > " + name + ".out"
+    ).c_str());
+    std::ifstream output(name + ".out");
+    return std::string(
+        std::istreambuf_iterator<char>(output),
+        std::istreambuf_iterator<char>()
+    );
+}
+
+const std::string g_goodSnippet =
+    "$std$\n"
+    "main = args > print('Hello, world!\\n').\n";
+const std::string g_badSnippet =
+    "$std$\n"
+    "main = args > print('Hello, world!\\n'\n";
+
+void testCompileSource(void) {
+    std::cout << "Testing nabd::compileSource." << std::endl;
+
+    const auto result = nabd::compileSource(g_goodSnippet, snippetInputs(0));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Generated " << result.cppCode.length() << " characters of C++"
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testParseError(void) {
+    std::cout << "Testing nabd::compileSource with a parse error." << std::endl;
+
+    const auto result = nabd::compileSource(g_badSnippet, snippetInputs(1));
+    std::cout
+        << "Is parse error: "
+        << (result.status == nabd::CompileStatus::ParseError) << std::endl;
+    for(const auto &diag : result.diagnostics) {
+        std::cout
+            << diag.fileName << ":" << diag.line << ":" << diag.col << ": "
+            << diag.message << std::endl;
+    }
+    std::cout << "Test completed." << std::endl;
+}
+
+void testConcurrentCompiles(void) {
+    std::cout
+        << "Testing nabd::compileSource from several threads." << std::endl;
+
+    const int numThreads = 8;
+    std::vector<nabd::CompileResult> results(numThreads);
+    std::vector<std::thread> threads;
+    for(int i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([&results, i]() {
+            results[i] = nabd::compileSource(
+                i % 2 == 0 ? g_goodSnippet : g_badSnippet,
+                snippetInputs(i + 2)
+            );
+        }));
+    }
+    for(auto &thread : threads) {
+        thread.join();
+    }
+
+    int passed = 0, failed = 0;
+    for(const auto &result : results) {
+        if(result.success()) {
+            passed++;
+        } else {
+            failed++;
+        }
+    }
+    std::cout
+        << "Succeeded: " << passed << ", failed: " << failed
+        << " (expected " << numThreads / 2 << " each)" << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testCBackend(void) {
+    std::cout << "Testing nabd::compileSource with the C backend." << std::endl;
+
+    auto inputs = snippetInputs(10);
+    inputs.cBackend = true;
+    const auto result = nabd::compileSource(g_goodSnippet, inputs);
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Defines nabd_fn_main: "
+        << (result.cppCode.find("NabdVar *nabd_fn_main(NabdVar *args) {")
+            != std::string::npos) << std::endl
+        << "Uses the C std: "
+        << (result.cppCode.find("#include <NabdStd.h>") != std::string::npos)
+        << std::endl;
+
+    // A debug build has to print the same as the normal one
+    const std::string lists =
+        "$std$\n"
+        "main = args > print([ 'x', [ len(args), 'y' ], { 'a', [ ] } ]).\n";
+    auto cInputs = snippetInputs(27);
+    cInputs.cBackend = true;
+    cInputs.cCompiler = "gcc"; // What nabc picks without --cc or $NABC_CC
+    const auto cOutput = runSnippet(lists, cInputs, "");
+    std::cout
+        << "Prints lists like the C++ runtime: "
+        << (cOutput != ""
+            && cOutput == runSnippet(lists, snippetInputs(28), ""))
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testConstantFolding(void) {
+    std::cout << "Testing constant folding of std calls." << std::endl;
+
+    const std::string snippet =
+        "$std$\n"
+        "main = args > ! gt({ inc(0d1#), round(0d1.4#) }) ? [\n"
+        "    print(fst({ 0d3#, 'x' })),\n"
+        "    print(gt({ ceil(dec(0d0.5#)), parseNum(input(0d0#)) })) ] :\n"
+        "    print('never').\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(11));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Calls gt: "
+        << (result.cppCode.find("gt(") != std::string::npos) << std::endl
+        << "Prints the folded string: "
+        << (result.cppCode.find("print(" + constantFor(
+            result.cppCode, "std::make_shared<StringVariable>(\"3.000000\")"
+        ) + ")") != std::string::npos) << std::endl
+        << "Keeps the sign of -0: "
+        << (result.cppCode.find("(-0.0)") != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testPureCalls(void) {
+    std::cout << "Testing compile time calls to pure functions." << std::endl;
+
+    // count finishes, but forever never does and has to be left alone
+    const std::string snippet =
+        "$std$\n"
+        "count = n > ! gt({ n, 0d0# }) ? inc(count(dec(n))) : 0d0#.\n"
+        "forever = n > ! gt({ n, 0d0# }) ? forever(inc(n)) : n.\n"
+        "main = args > [ count(0d10#), forever(0d1#), print(0d1#) ].\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(12));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Folded count: "
+        << (result.cppCode.find("NumberVariable>(10)") != std::string::npos)
+        << std::endl
+        << "Left forever: "
+        << (result.cppCode.find("forever__num(static_cast<double>(1))")
+            != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testTailCalls(void) {
+    std::cout << "Testing tail calls turned into loops." << std::endl;
+
+    // Reading input keeps these from being worked out while compiling
+    const std::string snippet =
+        "$std$\n"
+        "isEven = n > ! eq({ n, 0d0# }) ? 'even' : isOdd(dec(n)).\n"
+        "isOdd = n > ! eq({ n, 0d0# }) ? 'odd' : isEven(dec(n)).\n"
+        "main = args > print(isEven(parseNum(input(0d0#)))).\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(13));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Puts isEven and isOdd in a loop: "
+        << (result.cppCode.find("__tail(int tcase")
+            != std::string::npos) << std::endl
+        << "Loops instead of calling: "
+        << (result.cppCode.find("continue;") != std::string::npos)
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testBigStack(void) {
+    std::cout << "Testing main on a thread with a bigger stack." << std::endl;
+
+    auto inputs = snippetInputs(14);
+    inputs.stackMegabytes = 512;
+    const auto result = nabd::compileSource(g_goodSnippet, inputs);
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Sets the stack size: "
+        << (result.cppCode.find(
+            "pthread_attr_setstacksize(&attr, 512ull * 1024 * 1024);")
+            != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testAccumulators(void) {
+    std::cout << "Testing linear recursion turned into loops." << std::endl;
+
+    const std::string snippet =
+        "$std$\n"
+        "depth = n > ! gt({ n, 0d0# }) ? inc(depth(dec(n))) : 0d0#.\n"
+        "main = args > print(depth(parseNum(input(0d0#)))).\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(15));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Counts the steps: "
+        << (result.cppCode.find("tpending++;") != std::string::npos)
+        << std::endl
+        << "Reports depth__num: "
+        << (result.log.find("'depth__num'") != std::string::npos)
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testInlining(void) {
+    std::cout << "Testing inlining of small functions." << std::endl;
+
+    // twice uses its argument two times, so input is bound to a temporary
+    const std::string snippet =
+        "$std$\n"
+        "twice = x > { x, x }.\n"
+        "isBig = n > gt({ n, 0d10# }).\n"
+        "main = args > [\n"
+        "    print(twice(input(0d0#))),\n"
+        "    print(! isBig(0d20#) ? 'big' : 'small') ].\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(16));
+    const auto mainCode = result.cppCode.substr(
+        result.cppCode.find("VariablePointer fake_main(const")
+    );
+    const auto big = constantFor(
+        result.cppCode, "std::make_shared<StringVariable>(\"big\")"
+    );
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Calls twice: "
+        << (mainCode.find("twice(") != std::string::npos) << std::endl
+        << "Binds input to a temporary: "
+        << (mainCode.find("const VariablePointer v0 = input(")
+            != std::string::npos) << std::endl
+        << "Folds through isBig: "
+        << (mainCode.find("print(" + big + ")") != std::string::npos)
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testImportInlining(void) {
+    std::cout << "Testing inlining of another module's functions." << std::endl;
+
+    // isBig is small and pure, but shout prints so it stays a call
+    std::ofstream("obj/inlineLib.nabd")
+        << "$std$\n"
+        << "isBig = n > gt({ n, 0d10# }).\n"
+        << "shout = s > print(s).\n";
+    const std::string snippet =
+        "$std$\n"
+        "$inlineLib$\n"
+        "main = args > shout(! isBig(0d20#) ? 'big' : 'small').\n";
+    auto inputs = snippetInputs(17);
+    inputs.includeFolders.push_back("obj");
+    const auto result = nabd::compileSource(snippet, inputs);
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Calls isBig: "
+        << (result.cppCode.find("isBig(") != std::string::npos) << std::endl
+        << "Folds through isBig: "
+        << (result.cppCode.find("shout(" + constantFor(
+            result.cppCode, "std::make_shared<StringVariable>(\"big\")"
+        ) + ")") != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testDeadCode(void) {
+    std::cout << "Testing unreachable functions being left out." << std::endl;
+
+    // greet is inlined into main, so nothing calls it any more
+    const std::string snippet =
+        "$std$\n"
+        "greet = name > print(name).\n"
+        "unused = x > print('never').\n"
+        "echo = x > ! eq({ x, 'q' }) ? x : echo(print(input(0d0#))).\n"
+        "main = args > [ greet('hi'), echo(input(0d0#)) ].\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(18));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Defines unused: "
+        << (result.cppCode.find("unused(") != std::string::npos) << std::endl
+        << "Defines greet: "
+        << (result.cppCode.find("greet(") != std::string::npos) << std::endl
+        << "Defines echo: "
+        << (result.cppCode.find("VariablePointer echo(")
+            != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+size_t countOf(const std::string &code, const std::string &part) {
+    size_t count = 0;
+    for(auto at = code.find(part); at != std::string::npos;
+            at = code.find(part, at + 1)) {
+        count++;
+    }
+    return count;
+}
+
+void testCse(void) {
+    std::cout << "Testing repeated pure calls worked out once." << std::endl;
+
+    // The prints have to stay two, and in order
+    const std::string snippet =
+        "$std$\n"
+        "show = st > [\n"
+        "    print(fst(snd(st))), print('-'), print('-'),\n"
+        "    print(snd(snd(st))), print(fst(snd(st))) ].\n"
+        "main = args > show({ 0d1#, { input(0d0#), input(0d0#) } }).\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(19));
+
+    // show also gets a clone taking st's halves, so only look at show
+    const auto start = result.cppCode.find("VariablePointer show(const");
+    const auto show = result.cppCode.substr(
+        start, result.cppCode.find("\n}\n", start) - start
+    );
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Calls snd(st) once: "
+        << (countOf(show, "snd(st)") == 1) << std::endl
+        << "Still prints '-' twice: "
+        << (countOf(show, "print(" + constantFor(
+            result.cppCode, "std::make_shared<StringVariable>(\"-\")"
+        ) + ")") == 2) << std::endl;
+
+    // fst of a string makes a new one, which both items then share
+    auto inputs = snippetInputs(25);
+    inputs.inlineSize = 0;
+    const std::string shared =
+        "$std$\n"
+        "twice = s > print([ fst(s), fst(s) ]).\n"
+        "main = args > twice(input(0d0#)).\n";
+    std::cout
+        << "Prints a shared call's result twice: "
+        << (runSnippet(shared, inputs, "ab\n") == "{abab, ") << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testMemoize(void) {
+    std::cout
+        << "Testing memoization of pure recursive functions." << std::endl;
+
+    /*
+     * noisy prints, so it has to run every time. g's second call is a tail
+     * call but its first isn't, while down only ever loops
+     */
+    const std::string snippet =
+        "$std$\n"
+        "f = n > ! lt({ n, 0d2# }) ? n : gt({ f(dec(n)), f(dec(dec(n))) }).\n"
+        "g = n > ! lt({ n, 0d1# }) ? n : snd({ g(dec(n)), g(dec(n)) }).\n"
+        "down = n > ! lt({ n, 0d1# }) ? n : down(dec(n)).\n"
+        "noisy = n > ! lt({ n, 0d1# }) ? n : noisy(print(dec(n))).\n"
+        "main = args > [\n"
+        "    print(f(parseNum(input(0d0#)))),\n"
+        "    print(g(parseNum(input(0d0#)))),\n"
+        "    print(down(parseNum(input(0d0#)))),\n"
+        "    gt({ noisy(parseNum(input(0d0#))), noisy(0d3#) }) ].\n";
+    auto inputs = snippetInputs(20);
+    inputs.memoEntries = 64;
+    const auto result = nabd::compileSource(snippet, inputs);
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Caches f's number clone: "
+        << (result.cppCode.find(
+            "static MemoTable f__num__memo(\"f__num\", 64);")
+            != std::string::npos) << std::endl
+        << "Caches g's number clone: "
+        << (result.cppCode.find("g__num__memo") != std::string::npos)
+        << std::endl
+        << "Caches down: "
+        << (result.cppCode.find("MemoTable down") != std::string::npos)
+        << std::endl
+        << "Caches noisy: "
+        << (result.cppCode.find("noisy__memo") != std::string::npos)
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testSequencing(void) {
+    std::cout << "Testing thrown away lists run in order." << std::endl;
+
+    // Nothing uses count's list either, so it's only the prints
+    const std::string snippet =
+        "$std$\n"
+        "count = n > ! lt({ n, 0d1# }) ? n : [ print(n), count(dec(n)) ].\n"
+        "main = args > snd({ [\n"
+        "    print('a'), count(parseNum(input(0d0#))), print('c') ],\n"
+        "    0d0# }).\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(21));
+    const auto funcs =
+        result.cppCode.substr(0, result.cppCode.find("int main("));
+    const auto printA = funcs.find("print(" + constantFor(
+        funcs, "std::make_shared<StringVariable>(\"a\")"
+    ) + ")");
+    const auto printC = funcs.find("print(" + constantFor(
+        funcs, "std::make_shared<StringVariable>(\"c\")"
+    ) + ")");
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Builds a list: "
+        << (funcs.find("ListVariable") != std::string::npos) << std::endl
+        << "Prints in order: "
+        << (printA != std::string::npos && printC != std::string::npos
+            && printA < printC) << std::endl;
+
+    // Empty lists have no items to run or keep, wherever they are
+    const std::string empty =
+        "$std$\n"
+        "main = args > snd({\n"
+        "    [ print(len([ ])), [ ] ], fst({ [ ], 0d0# }) }).\n";
+    std::cout
+        << "Handles empty lists: "
+        << nabd::compileSource(empty, snippetInputs(26)).success()
+        << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testTupleClones(void) {
+    std::cout << "Testing tuple literals passed as their halves." << std::endl;
+
+    // g passes its parameter on whole, so it still needs a real tuple
+    const std::string snippet =
+        "$std$\n"
+        "f = p > ! lt({ fst(p), 0d2# }) ? snd(p) : gt({\n"
+        "    f({ dec(fst(p)), snd(p) }), f({ dec(dec(fst(p))), snd(p) }) }).\n"
+        "g = p > [ print('g'), f(p) ].\n"
+        "main = args > [\n"
+        "    print(f({ parseNum(input(0d0#)), 0d7# })),\n"
+        "    g(dup(0d3#)) ].\n";
+    auto inputs = snippetInputs(22);
+    inputs.inlineSize = 0;
+    const auto result = nabd::compileSource(snippet, inputs);
+    const auto funcs =
+        result.cppCode.substr(0, result.cppCode.find("int main("));
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Defines f__tup: "
+        << (funcs.find("VariablePointer f__tup(const VariablePointer &p__fst, "
+            "const VariablePointer &p__snd) {") != std::string::npos)
+        << std::endl
+        << "Only builds g's tuple: "
+        << (countOf(funcs, "make_shared<TupleVariable>") == 1) << std::endl
+        << "Defines g__tup: "
+        << (funcs.find("g__tup") != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testConstants(void) {
+    std::cout << "Testing literals made once as constants." << std::endl;
+
+    const std::string snippet =
+        "$std$\n"
+        "loop = n > ! lt({ n, 0d1# }) ? [ 0d1#, 0d2#, 'x' ] :\n"
+        "    snd({ print('tick'), loop(dec(n)) }).\n"
+        "main = args > print(loop(parseNum(input(0d0#)))).\n";
+    const auto result = nabd::compileSource(snippet, snippetInputs(23));
+    const auto &code = result.cppCode;
+    const auto start =
+        code.find("VariablePointer loop(const VariablePointer &n) {");
+    const auto funcs = code.substr(start, code.find("int main(") - start);
+    const auto list =
+        "std::make_shared<ListVariable>(std::vector<VariablePointer>({ "
+        + constantFor(code, "std::make_shared<NumberVariable>(1)") + ", "
+        + constantFor(code, "std::make_shared<NumberVariable>(2)") + ", "
+        + constantFor(code, "std::make_shared<StringVariable>(\"x\")")
+        + ", }))";
+    std::cout
+        << "Success: " << result.success() << std::endl
+        << "Makes anything in the functions: "
+        << (funcs.find("make_shared") != std::string::npos) << std::endl
+        << "Makes the list from its items: "
+        << (constantFor(code, list) != "") << std::endl
+        << "Prints the constant: "
+        << (funcs.find("print(" + constantFor(
+            code, "std::make_shared<StringVariable>(\"tick\")"
+        ) + ")") != std::string::npos) << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testRepeatedItems(void) {
+    std::cout << "Testing lists holding the same constant twice." << std::endl;
+
+    // Both 'x's are the same constant, but each still gets its separator
+    const std::string snippet =
+        "$std$\n"
+        "main = args > print([ 'x', 'y', 'x', len(args) ]).\n";
+    const auto output = runSnippet(snippet, snippetInputs(24), "");
+    std::cout
+        << "Prints every item: "
+        << (output == "{xy, x, 0.000000, ") << std::endl
+        << "Test completed." << std::endl;
+}
+
+void testShardedConstants(void) {
+    std::cout << "Testing constants shared by a module's shards." << std::endl;
+
+    // Enough functions (too big to inline) that the module is split up
+    const size_t funcCount = 40, printCount = 20;
+    std::string snippet = "$std$\n", calls, expected;
+    for(size_t i = 0; i < funcCount; i++) {
+        snippet += "f" + std::to_string(i) + " = a > [";
+        for(size_t j = 0; j < printCount; j++) {
+            snippet += " print('a'), print('b'),";
+            expected += "ab";
+        }
+        snippet += " len(a) ].\n";
+        calls += " f" + std::to_string(i) + "(args),";
+    }
+    snippet += "main = args > [" + calls + " 0d0# ].\n";
+    const auto output = runSnippet(snippet, snippetInputs(29), "");
+
+    std::ifstream declsFile("obj/snippet29_nabdout/snippet29_decls.hpp");
+    const std::string decls(
+        (std::istreambuf_iterator<char>(declsFile)),
+        std::istreambuf_iterator<char>()
+    );
+    size_t definingShards = 0;
+    for(size_t shard = 0; ; shard++) {
+        std::ifstream shardFile(
+            "obj/snippet29_nabdout/snippet29_shard"
+                + std::to_string(shard) + ".cpp"
+        );
+        if(!shardFile) {
+            break;
+        }
+        const std::string code(
+            (std::istreambuf_iterator<char>(shardFile)),
+            std::istreambuf_iterator<char>()
+        );
+        if(code.find(
+                " = std::make_shared<StringVariable>(\"a\");\n"
+            ) != std::string::npos) {
+            definingShards++;
+        }
+    }
+    std::cout
+        << "Prints everything: " << (output == expected) << std::endl
+        << "Only declares them in the header: "
+        << (decls.find("extern const VariablePointer") != std::string::npos
+            && decls.find("make_shared") == std::string::npos) << std::endl
+        << "Makes them in one shard: " << (definingShards == 1) << std::endl
+        << "Test completed." << std::endl;
+}